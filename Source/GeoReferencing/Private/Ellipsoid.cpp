@@ -70,3 +70,116 @@ FVector FEllipsoid::GeodeticSurfaceNormal(const FGeographicCoordinates& Geograph
 	Normal.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
 	return Normal;
 }
+
+bool FEllipsoid::IsOfRevolution() const
+{
+	return Radii.X == Radii.Y;
+}
+
+FVector FEllipsoid::GeographicToECEF(const FGeographicCoordinates& GeographicCoordinates) const
+{
+	const double SquaredEccentricity = 1.0 - RadiiSquared.Z * OneOverRadiiSquared.X;
+
+	double SinLatitude, CosLatitude, SinLongitude, CosLongitude;
+	FMath::SinCos(&SinLatitude, &CosLatitude, FMathd::DegToRad * GeographicCoordinates.Latitude);
+	FMath::SinCos(&SinLongitude, &CosLongitude, FMathd::DegToRad * GeographicCoordinates.Longitude);
+
+	// Prime vertical radius of curvature
+	const double N = Radii.X / FMathd::Sqrt(1.0 - SquaredEccentricity * SinLatitude * SinLatitude);
+
+	return FVector(
+		(N + GeographicCoordinates.Altitude) * CosLatitude * CosLongitude,
+		(N + GeographicCoordinates.Altitude) * CosLatitude * SinLongitude,
+		(N * (1.0 - SquaredEccentricity) + GeographicCoordinates.Altitude) * SinLatitude);
+}
+
+FVector FEllipsoid::GeographicToECEFWithENU(const FGeographicCoordinates& GeographicCoordinates, FVector& East, FVector& North, FVector& Up) const
+{
+	const double SquaredEccentricity = 1.0 - RadiiSquared.Z * OneOverRadiiSquared.X;
+
+	double SinLatitude, CosLatitude, SinLongitude, CosLongitude;
+	FMath::SinCos(&SinLatitude, &CosLatitude, FMathd::DegToRad * GeographicCoordinates.Latitude);
+	FMath::SinCos(&SinLongitude, &CosLongitude, FMathd::DegToRad * GeographicCoordinates.Longitude);
+
+	// The geodetic normal is the direction given by the geodetic latitude and longitude
+	Up = FVector(CosLatitude * CosLongitude, CosLatitude * SinLongitude, SinLatitude);
+	East = FVector(-SinLongitude, CosLongitude, 0.0);
+	North = FVector(-SinLatitude * CosLongitude, -SinLatitude * SinLongitude, CosLatitude); // Up ^ East
+
+	const double N = Radii.X / FMathd::Sqrt(1.0 - SquaredEccentricity * SinLatitude * SinLatitude);
+
+	return FVector(
+		(N + GeographicCoordinates.Altitude) * CosLatitude * CosLongitude,
+		(N + GeographicCoordinates.Altitude) * CosLatitude * SinLongitude,
+		(N * (1.0 - SquaredEccentricity) + GeographicCoordinates.Altitude) * SinLatitude);
+}
+
+FGeographicCoordinates FEllipsoid::ECEFToGeographic(const FVector& ECEFLocation) const
+{
+	// H. Vermeille, "An analytical method to transform geocentric into geodetic coordinates", J. Geod. (2011) 85:105-117
+	const double A = Radii.X;
+	const double SquaredEccentricity = 1.0 - RadiiSquared.Z * OneOverRadiiSquared.X;
+	const double E4 = SquaredEccentricity * SquaredEccentricity;
+
+	const double DistanceToAxis = FMathd::Sqrt(ECEFLocation.X * ECEFLocation.X + ECEFLocation.Y * ECEFLocation.Y);
+	const double P = (DistanceToAxis * DistanceToAxis) * OneOverRadiiSquared.X;
+	const double Q = (1.0 - SquaredEccentricity) * ECEFLocation.Z * ECEFLocation.Z * OneOverRadiiSquared.X;
+	const double R = (P + Q - E4) / 6.0;
+	const double EvoluteBorderTest = 8.0 * R * R * R + E4 * P * Q;
+
+	double LatitudeRad;
+	double Altitude;
+	if (EvoluteBorderTest > 0.0 || Q != 0.0)
+	{
+		double U;
+		if (EvoluteBorderTest > 0.0)
+		{
+			// Outside the evolute - the usual case
+			const double Rad1 = FMathd::Sqrt(EvoluteBorderTest);
+			const double Rad2 = FMathd::Sqrt(E4 * P * Q);
+			if (EvoluteBorderTest > 10.0 * SquaredEccentricity)
+			{
+				const double Rad3 = FMathd::Pow((Rad1 + Rad2) * (Rad1 + Rad2), 1.0 / 3.0);
+				U = R + 0.5 * Rad3 + 2.0 * R * R / Rad3;
+			}
+			else
+			{
+				U = R + 0.5 * FMathd::Pow((Rad1 + Rad2) * (Rad1 + Rad2), 1.0 / 3.0) + 0.5 * FMathd::Pow((Rad1 - Rad2) * (Rad1 - Rad2), 1.0 / 3.0);
+			}
+		}
+		else
+		{
+			// Inside the evolute, close to the planet center
+			const double Rad1 = FMathd::Sqrt(-EvoluteBorderTest);
+			const double Rad2 = FMathd::Sqrt(-8.0 * R * R * R);
+			const double Rad3 = FMathd::Sqrt(E4 * P * Q);
+			const double Angle = 2.0 * FMathd::Atan2(Rad3, Rad1 + Rad2) / 3.0;
+			U = -4.0 * R * FMathd::Sin(Angle) * FMathd::Cos(FMathd::Pi / 6.0 + Angle);
+		}
+
+		const double V = FMathd::Sqrt(U * U + E4 * Q);
+		const double W = SquaredEccentricity * (U + V - Q) / (2.0 * V);
+		const double K = (U + V) / (FMathd::Sqrt(W * W + U + V) + W);
+		const double D = K * DistanceToAxis / (K + SquaredEccentricity);
+		const double SqrtDDpZZ = FMathd::Sqrt(D * D + ECEFLocation.Z * ECEFLocation.Z);
+
+		Altitude = (K + SquaredEccentricity - 1.0) * SqrtDDpZZ / K;
+		LatitudeRad = 2.0 * FMathd::Atan2(ECEFLocation.Z, SqrtDDpZZ + D);
+	}
+	else
+	{
+		// On the singular disc of the equatorial plane, a few dozens of km around the center - Latitude is not unique there, keep the northern solution
+		const double Eccentricity = FMathd::Sqrt(SquaredEccentricity);
+		const double Rad1 = FMathd::Sqrt(1.0 - SquaredEccentricity);
+		const double Rad2 = FMathd::Sqrt(SquaredEccentricity - P);
+
+		Altitude = -A * Rad1 * Rad2 / Eccentricity;
+		LatitudeRad = FMathd::Atan2(FMathd::Sqrt(FMathd::Max(E4 - P, 0.0)), FMathd::Sqrt(P));
+	}
+
+	FGeographicCoordinates GeographicCoordinates;
+	GeographicCoordinates.Longitude = FMathd::RadToDeg * FMathd::Atan2(ECEFLocation.Y, ECEFLocation.X);
+	GeographicCoordinates.Latitude = FMathd::RadToDeg * LatitudeRad;
+	GeographicCoordinates.Altitude = Altitude;
+	return GeographicCoordinates;
+}
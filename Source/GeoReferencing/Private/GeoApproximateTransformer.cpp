@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoApproximateTransformer.h"
+#include "HAL/PlatformTime.h"
+
+void FGeoApproximateTransformer::Build(const FBox& InBounds, double InMaxError, int32 MaxDepth, FExactTransform ExactTransform, FErrorMetric ErrorMetric)
+{
+	Bounds = InBounds;
+	ZMin = Bounds.Min.Z;
+	ZRange = FMath::Max(Bounds.Max.Z - Bounds.Min.Z, 1.0); // Keep a valid derivative when all the points share the same Z
+	MaxError = InMaxError;
+	MeasuredMaxError = 0.0;
+	NumExactSamples = 0;
+	ExactSamplesSeconds = 0.0;
+	Nodes.Reset();
+	Leaves.Reset();
+
+	Nodes.AddDefaulted();
+	Refine(0, FVector2D(Bounds.Min.X, Bounds.Min.Y), FVector2D(Bounds.Max.X, Bounds.Max.Y), 0, MaxDepth, ExactTransform, ErrorMetric);
+}
+
+void FGeoApproximateTransformer::Refine(int32 NodeIndex, const FVector2D& CellMin, const FVector2D& CellMax, int32 Depth, int32 MaxDepth, FExactTransform ExactTransform, FErrorMetric ErrorMetric)
+{
+	// Exact samples on the 3x3 lattice of the cell, at the bottom and top of the Z range, plus the center at mid height
+	const double ZMax = ZMin + ZRange;
+	const double ZMid = ZMin + 0.5 * ZRange;
+	const int32 NumLattice = 9;
+	FGeoCoordinateBuffer Samples(2 * NumLattice + 1);
+	for (int32 j = 0; j < 3; ++j)
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const double X = FMath::Lerp(CellMin.X, CellMax.X, 0.5 * i);
+			const double Y = FMath::Lerp(CellMin.Y, CellMax.Y, 0.5 * j);
+			Samples.Add(FVector(X, Y, ZMin));
+			Samples.Add(FVector(X, Y, ZMax));
+		}
+	}
+	Samples.Add(FVector(0.5 * (CellMin.X + CellMax.X), 0.5 * (CellMin.Y + CellMax.Y), ZMid));
+
+	const double StartTime = FPlatformTime::Seconds();
+	ExactTransform(FGeoCoordinateStreams::Make(Samples));
+	ExactSamplesSeconds += FPlatformTime::Seconds() - StartTime;
+	NumExactSamples += Samples.Num();
+
+	auto LatticeValue = [&Samples](int32 i, int32 j, bool bTop) { return Samples.GetVector(2 * (3 * j + i) + (bTop ? 1 : 0)); };
+
+	FLeaf Leaf;
+	const int32 CornerIndices[4][2] = { { 0, 0 }, { 2, 0 }, { 0, 2 }, { 2, 2 } };
+	for (int32 Corner = 0; Corner < 4; ++Corner)
+	{
+		const FVector Bottom = LatticeValue(CornerIndices[Corner][0], CornerIndices[Corner][1], false);
+		const FVector Top = LatticeValue(CornerIndices[Corner][0], CornerIndices[Corner][1], true);
+		Leaf.Values[Corner] = Bottom;
+		Leaf.Derivatives[Corner] = (Top - Bottom) / ZRange;
+	}
+
+	// Interpolation error on the non corner lattice points, and at the center of the cell
+	double CellError = 0.0;
+	for (int32 j = 0; j < 3; ++j)
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			if (i != 1 && j != 1)
+			{
+				continue; // Corner, exact by construction
+			}
+			CellError = FMath::Max(CellError, ErrorMetric(LatticeValue(i, j, false), Interpolate(Leaf, 0.5 * i, 0.5 * j, ZMin)));
+			CellError = FMath::Max(CellError, ErrorMetric(LatticeValue(i, j, true), Interpolate(Leaf, 0.5 * i, 0.5 * j, ZMax)));
+		}
+	}
+	CellError = FMath::Max(CellError, ErrorMetric(Samples.GetVector(2 * NumLattice), Interpolate(Leaf, 0.5, 0.5, ZMid)));
+
+	// The test points are not the worst case of the cell : keep a safety factor of 2
+	if (FMath::IsFinite(CellError) && CellError <= 0.5 * MaxError)
+	{
+		MeasuredMaxError = FMath::Max(MeasuredMaxError, CellError);
+		Nodes[NodeIndex].Leaf = Leaves.Add(Leaf);
+		return;
+	}
+
+	if (Depth >= MaxDepth)
+	{
+		// Leaf without approximation, converted exactly
+		return;
+	}
+
+	const int32 FirstChild = Nodes.AddDefaulted(4);
+	Nodes[NodeIndex].FirstChild = FirstChild;
+
+	const FVector2D CellCenter = 0.5 * (CellMin + CellMax);
+	Refine(FirstChild + 0, CellMin, CellCenter, Depth + 1, MaxDepth, ExactTransform, ErrorMetric);
+	Refine(FirstChild + 1, FVector2D(CellCenter.X, CellMin.Y), FVector2D(CellMax.X, CellCenter.Y), Depth + 1, MaxDepth, ExactTransform, ErrorMetric);
+	Refine(FirstChild + 2, FVector2D(CellMin.X, CellCenter.Y), FVector2D(CellCenter.X, CellMax.Y), Depth + 1, MaxDepth, ExactTransform, ErrorMetric);
+	Refine(FirstChild + 3, CellCenter, CellMax, Depth + 1, MaxDepth, ExactTransform, ErrorMetric);
+}
+
+FVector FGeoApproximateTransformer::Interpolate(const FLeaf& Leaf, double U, double V, double Z) const
+{
+	const double W00 = (1.0 - U) * (1.0 - V);
+	const double W10 = U * (1.0 - V);
+	const double W01 = (1.0 - U) * V;
+	const double W11 = U * V;
+
+	const FVector Value = Leaf.Values[0] * W00 + Leaf.Values[1] * W10 + Leaf.Values[2] * W01 + Leaf.Values[3] * W11;
+	const FVector Derivative = Leaf.Derivatives[0] * W00 + Leaf.Derivatives[1] * W10 + Leaf.Derivatives[2] * W01 + Leaf.Derivatives[3] * W11;
+	return Value + Derivative * (Z - ZMin);
+}
+
+void FGeoApproximateTransformer::Transform(const FGeoCoordinateStreams& Streams, FExactTransform ExactTransform) const
+{
+	TArray<int32> ExactIndices;
+
+	for (int32 Index = 0; Index < Streams.Num; ++Index)
+	{
+		const FVector Input = Streams.GetVector(Index);
+		if (Nodes.Num() == 0 || !Bounds.IsInsideOrOn(Input))
+		{
+			ExactIndices.Add(Index);
+			continue;
+		}
+
+		// Descend the quadtree
+		FVector2D CellMin(Bounds.Min.X, Bounds.Min.Y);
+		FVector2D CellMax(Bounds.Max.X, Bounds.Max.Y);
+		const FNode* Node = &Nodes[0];
+		while (Node->FirstChild != INDEX_NONE)
+		{
+			const FVector2D CellCenter = 0.5 * (CellMin + CellMax);
+			const bool bUpperX = Input.X >= CellCenter.X;
+			const bool bUpperY = Input.Y >= CellCenter.Y;
+			(bUpperX ? CellMin.X : CellMax.X) = CellCenter.X;
+			(bUpperY ? CellMin.Y : CellMax.Y) = CellCenter.Y;
+			Node = &Nodes[Node->FirstChild + (bUpperX ? 1 : 0) + (bUpperY ? 2 : 0)];
+		}
+
+		if (Node->Leaf == INDEX_NONE)
+		{
+			ExactIndices.Add(Index);
+			continue;
+		}
+
+		const double U = CellMax.X > CellMin.X ? (Input.X - CellMin.X) / (CellMax.X - CellMin.X) : 0.0;
+		const double V = CellMax.Y > CellMin.Y ? (Input.Y - CellMin.Y) / (CellMax.Y - CellMin.Y) : 0.0;
+		Streams.SetVector(Index, Interpolate(Leaves[Node->Leaf], U, V, Input.Z));
+	}
+
+	if (ExactIndices.Num() > 0)
+	{
+		FGeoCoordinateBuffer Exact(ExactIndices.Num());
+		for (int32 Index : ExactIndices)
+		{
+			Exact.Add(Streams.GetVector(Index));
+		}
+		ExactTransform(FGeoCoordinateStreams::Make(Exact));
+		for (int32 i = 0; i < ExactIndices.Num(); ++i)
+		{
+			Streams.SetVector(ExactIndices[i], Exact.GetVector(i));
+		}
+	}
+}
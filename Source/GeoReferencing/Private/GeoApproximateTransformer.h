@@ -0,0 +1,73 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GeoCoordinateBuffer.h"
+
+/**
+ * Approximation of a conversion over a bounding box, in the spirit of GDAL's approximate transformer.
+ * The exact conversion is sampled on an adaptive quadtree covering the XY extent of the box. Each leaf interpolates bilinearly
+ * the converted value at the lowest Z of the box and its derivative along Z, which is enough for the slightly curved
+ * vertical behavior of geodetic conversions over a limited altitude range.
+ * A cell is subdivided until the interpolation matches the exact conversion within half the maximum error at its center
+ * and edge midpoints, at the bottom, middle and top of the Z range. Cells still failing at the maximum depth, and points
+ * outside the box, are converted exactly.
+ */
+class FGeoApproximateTransformer
+{
+public:
+	/** Exact conversion, in place */
+	typedef TFunctionRef<void(const FGeoCoordinateStreams&)> FExactTransform;
+
+	/** Distance in meters between two converted coordinates, the output units depending on the conversion */
+	typedef TFunctionRef<double(const FVector&, const FVector&)> FErrorMetric;
+
+	/**
+	 * Sample the exact conversion over Bounds
+	 * @param MaxError Maximum error accepted, in meters
+	 * @param MaxDepth Maximum subdivision level of the quadtree
+	 */
+	void Build(const FBox& Bounds, double MaxError, int32 MaxDepth, FExactTransform ExactTransform, FErrorMetric ErrorMetric);
+
+	/** Convert coordinates in place, using the exact conversion for the points not covered by the approximation */
+	void Transform(const FGeoCoordinateStreams& Streams, FExactTransform ExactTransform) const;
+
+	bool Contains(const FBox& InBounds) const { return Nodes.Num() > 0 && Bounds.IsInsideOrOn(InBounds.Min) && Bounds.IsInsideOrOn(InBounds.Max); }
+	double GetMaxError() const { return MaxError; }
+
+	/** Largest error found on the test points of the accepted cells, in meters */
+	double GetMeasuredMaxError() const { return MeasuredMaxError; }
+
+	/** Number of exact conversions done by Build() */
+	int32 GetNumExactSamples() const { return NumExactSamples; }
+
+	/** Time spent by the exact conversions in Build(), in seconds */
+	double GetExactSamplesSeconds() const { return ExactSamplesSeconds; }
+
+private:
+	struct FNode
+	{
+		int32 FirstChild = INDEX_NONE; // 4 consecutive children, ordered (MinX MinY), (MaxX MinY), (MinX MaxY), (MaxX MaxY)
+		int32 Leaf = INDEX_NONE; // INDEX_NONE for an inner node, or a leaf converted exactly
+	};
+
+	struct FLeaf
+	{
+		FVector Values[4]; // Converted corners at the lowest Z, same order as the children
+		FVector Derivatives[4]; // Derivative of the converted corners along Z
+	};
+
+	void Refine(int32 NodeIndex, const FVector2D& CellMin, const FVector2D& CellMax, int32 Depth, int32 MaxDepth, FExactTransform ExactTransform, FErrorMetric ErrorMetric);
+	FVector Interpolate(const FLeaf& Leaf, double U, double V, double Z) const;
+
+	FBox Bounds = FBox(ForceInit);
+	double ZMin = 0.0;
+	double ZRange = 1.0;
+	double MaxError = 0.0;
+	double MeasuredMaxError = 0.0;
+	int32 NumExactSamples = 0;
+	double ExactSamplesSeconds = 0.0;
+	TArray<FNode> Nodes;
+	TArray<FLeaf> Leaves;
+};
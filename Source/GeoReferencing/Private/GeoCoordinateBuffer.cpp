@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoCoordinateBuffer.h"
+
+FGeoCoordinateBuffer::FGeoCoordinateBuffer(int32 InitialCapacity)
+{
+	Reserve(InitialCapacity);
+}
+
+void FGeoCoordinateBuffer::SetNum(int32 NewNum)
+{
+	X.SetNumUninitialized(NewNum, false);
+	Y.SetNumUninitialized(NewNum, false);
+	Z.SetNumUninitialized(NewNum, false);
+}
+
+void FGeoCoordinateBuffer::Reset()
+{
+	X.Reset();
+	Y.Reset();
+	Z.Reset();
+}
+
+void FGeoCoordinateBuffer::Reserve(int32 NewCapacity)
+{
+	X.Reserve(NewCapacity);
+	Y.Reserve(NewCapacity);
+	Z.Reserve(NewCapacity);
+}
+
+int32 FGeoCoordinateBuffer::Add(const FVector& Coordinates)
+{
+	Y.Add(Coordinates.Y);
+	Z.Add(Coordinates.Z);
+	return X.Add(Coordinates.X);
+}
+
+int32 FGeoCoordinateBuffer::Add(const FGeographicCoordinates& Coordinates)
+{
+	Y.Add(Coordinates.Latitude);
+	Z.Add(Coordinates.Altitude);
+	return X.Add(Coordinates.Longitude);
+}
+
+void FGeoCoordinateBuffer::Set(int32 Index, const FVector& Coordinates)
+{
+	X[Index] = Coordinates.X;
+	Y[Index] = Coordinates.Y;
+	Z[Index] = Coordinates.Z;
+}
+
+void FGeoCoordinateBuffer::Set(int32 Index, const FGeographicCoordinates& Coordinates)
+{
+	X[Index] = Coordinates.Longitude;
+	Y[Index] = Coordinates.Latitude;
+	Z[Index] = Coordinates.Altitude;
+}
+
+void FGeoCoordinateBuffer::CopyFrom(TConstArrayView<FVector> Coordinates)
+{
+	SetNum(Coordinates.Num());
+	for (int32 i = 0; i < Coordinates.Num(); ++i)
+	{
+		Set(i, Coordinates[i]);
+	}
+}
+
+void FGeoCoordinateBuffer::CopyFrom(TConstArrayView<FGeographicCoordinates> Coordinates)
+{
+	SetNum(Coordinates.Num());
+	for (int32 i = 0; i < Coordinates.Num(); ++i)
+	{
+		Set(i, Coordinates[i]);
+	}
+}
+
+void FGeoCoordinateBuffer::CopyTo(TArrayView<FVector> Coordinates) const
+{
+	check(Coordinates.Num() == Num());
+	for (int32 i = 0; i < Coordinates.Num(); ++i)
+	{
+		Coordinates[i] = GetVector(i);
+	}
+}
+
+void FGeoCoordinateBuffer::CopyTo(TArrayView<FGeographicCoordinates> Coordinates) const
+{
+	check(Coordinates.Num() == Num());
+	for (int32 i = 0; i < Coordinates.Num(); ++i)
+	{
+		Coordinates[i] = GetGeographic(i);
+	}
+}
@@ -0,0 +1,118 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoCoordinateCache.h"
+
+namespace
+{
+	void MakeKey(const FVector& Input, uint64 (&OutKey)[3])
+	{
+		FMemory::Memcpy(&OutKey[0], &Input.X, sizeof(uint64));
+		FMemory::Memcpy(&OutKey[1], &Input.Y, sizeof(uint64));
+		FMemory::Memcpy(&OutKey[2], &Input.Z, sizeof(uint64));
+	}
+
+	// SplitMix64 finalizer
+	uint64 MixBits(uint64 Value)
+	{
+		Value = (Value ^ (Value >> 30)) * 0xbf58476d1ce4e5b9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94d049bb133111ebull;
+		return Value ^ (Value >> 31);
+	}
+}
+
+void FGeoCoordinateCache::Configure(int32 NumEntries)
+{
+	// A disabled cache keeps no memory at all
+	const uint32 NumSlots = NumEntries > 0 ? FMath::RoundUpToPowerOfTwo(FMath::Max(1, NumEntries / NumShards)) : 0;
+	for (FShard& Shard : Shards)
+	{
+		FRWScopeLock Lock(Shard.Lock, SLT_Write);
+		Shard.Entries.Empty(NumSlots);
+		Shard.Entries.SetNum(NumSlots);
+		Shard.SlotMask = NumSlots > 0 ? NumSlots - 1 : 0;
+	}
+}
+
+uint64 FGeoCoordinateCache::HashKey(EGeoConversion Conversion, const uint64 (&Key)[3])
+{
+	uint64 Hash = MixBits(Key[0] ^ static_cast<uint64>(Conversion));
+	Hash = MixBits(Hash ^ Key[1]);
+	return MixBits(Hash ^ Key[2]);
+}
+
+bool FGeoCoordinateCache::Find(EGeoConversion Conversion, const FVector& Input, FVector& OutResult, uint32& OutGeneration)
+{
+	uint64 Key[3];
+	MakeKey(Input, Key);
+	const uint64 Hash = HashKey(Conversion, Key);
+	FShard& Shard = Shards[Hash % NumShards];
+	const uint32 CurrentGeneration = Generation.load(std::memory_order_acquire);
+	OutGeneration = CurrentGeneration;
+
+	{
+		FRWScopeLock Lock(Shard.Lock, SLT_ReadOnly);
+		if (Shard.Entries.Num() > 0)
+		{
+			const FEntry& Entry = Shard.Entries[(Hash / NumShards) & Shard.SlotMask];
+			if (Entry.Generation == CurrentGeneration && Entry.Conversion == Conversion
+				&& Entry.Key[0] == Key[0] && Entry.Key[1] == Key[1] && Entry.Key[2] == Key[2])
+			{
+				OutResult = Entry.Result;
+				Shard.NumHits.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+	}
+
+	Shard.NumMisses.fetch_add(1, std::memory_order_relaxed);
+	return false;
+}
+
+void FGeoCoordinateCache::Add(EGeoConversion Conversion, const FVector& Input, const FVector& Result, uint32 InGeneration)
+{
+	uint64 Key[3];
+	MakeKey(Input, Key);
+	const uint64 Hash = HashKey(Conversion, Key);
+	FShard& Shard = Shards[Hash % NumShards];
+
+	FRWScopeLock Lock(Shard.Lock, SLT_Write);
+
+	// Checked under the lock : an outdated result doesn't even replace the entry of its slot
+	if (Shard.Entries.Num() > 0 && InGeneration == Generation.load(std::memory_order_acquire))
+	{
+		FEntry& Entry = Shard.Entries[(Hash / NumShards) & Shard.SlotMask];
+		FMemory::Memcpy(Entry.Key, Key, sizeof(Key));
+		Entry.Generation = InGeneration;
+		Entry.Conversion = Conversion;
+		Entry.Result = Result;
+	}
+}
+
+int64 FGeoCoordinateCache::GetNumHits() const
+{
+	int64 NumHits = 0;
+	for (const FShard& Shard : Shards)
+	{
+		NumHits += Shard.NumHits.load(std::memory_order_relaxed);
+	}
+	return NumHits;
+}
+
+int64 FGeoCoordinateCache::GetNumMisses() const
+{
+	int64 NumMisses = 0;
+	for (const FShard& Shard : Shards)
+	{
+		NumMisses += Shard.NumMisses.load(std::memory_order_relaxed);
+	}
+	return NumMisses;
+}
+
+void FGeoCoordinateCache::ResetCounters()
+{
+	for (FShard& Shard : Shards)
+	{
+		Shard.NumHits.store(0, std::memory_order_relaxed);
+		Shard.NumMisses.store(0, std::memory_order_relaxed);
+	}
+}
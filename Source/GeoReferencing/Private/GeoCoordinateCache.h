@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "GeoReferencingSystem.h"
+
+#include <atomic>
+
+/**
+ * Memoization of single point conversions, keyed on the exact bits of the input coordinates.
+ * Entries are spread over shards protected by their own read/write lock, each shard being a direct mapped table :
+ * a new entry replaces the one occupying its slot, so the memory used never grows after Configure().
+ * Invalidate() is lock free, it bumps a generation stamp that every entry must match to be valid.
+ */
+class FGeoCoordinateCache
+{
+public:
+	FGeoCoordinateCache() = default;
+
+	/** Reallocate the cache for (about) NumEntries entries, rounded to a power of two per shard, or release it if NumEntries is 0. Drops all the entries. */
+	void Configure(int32 NumEntries);
+
+	/** Drop all the entries */
+	void Invalidate() { Generation.fetch_add(1, std::memory_order_release); }
+
+	/**
+	 * Look a conversion up. On a miss, OutGeneration is the generation the result must be added with : a conversion running while the settings
+	 * change was computed with the previous ones, and must not be stamped with the new generation.
+	 */
+	bool Find(EGeoConversion Conversion, const FVector& Input, FVector& OutResult, uint32& OutGeneration);
+
+	/** Store a result computed after Find() returned InGeneration. Dropped if the cache was invalidated meanwhile. */
+	void Add(EGeoConversion Conversion, const FVector& Input, const FVector& Result, uint32 InGeneration);
+
+	int64 GetNumHits() const;
+	int64 GetNumMisses() const;
+	void ResetCounters();
+
+private:
+	static constexpr int32 NumShards = 16;
+
+	struct FEntry
+	{
+		uint64 Key[3];
+		uint32 Generation = 0; // 0 is never a valid generation
+		EGeoConversion Conversion = EGeoConversion::Count;
+		FVector Result;
+	};
+
+	struct FShard
+	{
+		FRWLock Lock;
+		TArray<FEntry> Entries;
+		uint32 SlotMask = 0;
+		std::atomic<int64> NumHits { 0 };
+		std::atomic<int64> NumMisses { 0 };
+	};
+
+	static uint64 HashKey(EGeoConversion Conversion, const uint64 (&Key)[3]);
+
+	FShard Shards[NumShards];
+	std::atomic<uint32> Generation { 1 };
+};
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoLatencyHistogram.h"
+
+int32 FGeoLatencyHistogram::GetBucketIndex(uint64 Value)
+{
+	Value = FMath::Min<uint64>(Value, (uint64(1) << MaxExponent) - 1);
+	if (Value < NumSubBuckets)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	// Values in [2^Exponent, 2^(Exponent+1)[ are split in NumSubBuckets buckets of width 2^(Exponent - SubBucketBits)
+	const int32 Exponent = static_cast<int32>(FMath::FloorLog2_64(Value));
+	const int32 Shift = Exponent - SubBucketBits;
+	const int32 SubBucket = static_cast<int32>(Value >> Shift) - NumSubBuckets;
+	return NumSubBuckets + Shift * NumSubBuckets + SubBucket;
+}
+
+uint64 FGeoLatencyHistogram::GetBucketLowerBound(int32 Index)
+{
+	if (Index < NumSubBuckets)
+	{
+		return static_cast<uint64>(Index);
+	}
+	const int32 Shift = (Index - NumSubBuckets) / NumSubBuckets;
+	const int32 SubBucket = (Index - NumSubBuckets) % NumSubBuckets;
+	return static_cast<uint64>(NumSubBuckets + SubBucket) << Shift;
+}
+
+uint64 FGeoLatencyHistogram::GetBucketWidth(int32 Index)
+{
+	return Index < NumSubBuckets ? 1 : uint64(1) << ((Index - NumSubBuckets) / NumSubBuckets);
+}
+
+void FGeoLatencyHistogram::AtomicMax(std::atomic<uint64>& Target, uint64 Value)
+{
+	uint64 Current = Target.load(std::memory_order_relaxed);
+	while (Value > Current && !Target.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+	{
+	}
+}
+
+void FGeoLatencyHistogram::Record(uint64 LatencyNanoseconds, int64 InNumItems)
+{
+	Buckets[GetBucketIndex(LatencyNanoseconds)].fetch_add(1, std::memory_order_relaxed);
+	NumSamples.fetch_add(1, std::memory_order_relaxed);
+	NumItems.fetch_add(static_cast<uint64>(FMath::Max<int64>(InNumItems, 0)), std::memory_order_relaxed);
+	SumNanoseconds.fetch_add(LatencyNanoseconds, std::memory_order_relaxed);
+	AtomicMax(MaxNanoseconds, LatencyNanoseconds);
+	AtomicMax(MaxItemNanoseconds, LatencyNanoseconds / static_cast<uint64>(FMath::Max<int64>(InNumItems, 1)));
+}
+
+void FGeoLatencyHistogram::Reset()
+{
+	for (std::atomic<uint64>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	NumSamples.store(0, std::memory_order_relaxed);
+	NumItems.store(0, std::memory_order_relaxed);
+	SumNanoseconds.store(0, std::memory_order_relaxed);
+	MaxNanoseconds.store(0, std::memory_order_relaxed);
+	MaxItemNanoseconds.store(0, std::memory_order_relaxed);
+}
+
+void FGeoLatencyHistogram::AccumulateTo(FSnapshot& Snapshot) const
+{
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Snapshot.Buckets[Index] += Buckets[Index].load(std::memory_order_relaxed);
+	}
+	Snapshot.NumSamples += NumSamples.load(std::memory_order_relaxed);
+	Snapshot.NumItems += NumItems.load(std::memory_order_relaxed);
+	Snapshot.SumNanoseconds += SumNanoseconds.load(std::memory_order_relaxed);
+	Snapshot.MaxNanoseconds = FMath::Max(Snapshot.MaxNanoseconds, MaxNanoseconds.load(std::memory_order_relaxed));
+	Snapshot.MaxItemNanoseconds = FMath::Max(Snapshot.MaxItemNanoseconds, MaxItemNanoseconds.load(std::memory_order_relaxed));
+}
+
+double FGeoLatencyHistogram::FSnapshot::GetPercentile(double Percentile) const
+{
+	// Samples are counted bucket by bucket, NumSamples may lag behind them while recording : use the bucket total
+	uint64 Total = 0;
+	for (uint64 Count : Buckets)
+	{
+		Total += Count;
+	}
+	if (Total == 0)
+	{
+		return 0.0;
+	}
+
+	const uint64 Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 1.0) * static_cast<double>(Total))));
+	uint64 Cumulated = 0;
+	for (int32 Index = 0; Index < NumBuckets; ++Index)
+	{
+		Cumulated += Buckets[Index];
+		if (Cumulated >= Rank)
+		{
+			const double Midpoint = static_cast<double>(GetBucketLowerBound(Index)) + 0.5 * static_cast<double>(GetBucketWidth(Index) - 1);
+			return FMath::Min(Midpoint, static_cast<double>(MaxNanoseconds));
+		}
+	}
+	return static_cast<double>(MaxNanoseconds);
+}
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ * Log-linear latency histogram (HDR style), recorded without any lock.
+ * Each power of two range is split in NumSubBuckets linear buckets, so any value is known within 1 / NumSubBuckets (6%), from 1 ns up to 2^MaxExponent ns (18 minutes).
+ * Counters are relaxed atomics : a snapshot taken during recording may miss the latest samples, but never sees torn values.
+ */
+class FGeoLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 NumSubBuckets = 1 << SubBucketBits;
+	static constexpr int32 MaxExponent = 40;
+	static constexpr int32 NumBuckets = NumSubBuckets * (MaxExponent - SubBucketBits + 1);
+
+	/** Counts of one or several histograms, merged */
+	struct FSnapshot
+	{
+		FSnapshot() { Buckets.SetNumZeroed(NumBuckets); }
+
+		TArray<uint64> Buckets;
+		uint64 NumSamples = 0;
+		uint64 NumItems = 0;
+		uint64 SumNanoseconds = 0;
+		uint64 MaxNanoseconds = 0;
+		uint64 MaxItemNanoseconds = 0;
+
+		/** Latency under which Percentile (in [0, 1]) of the samples fall, in nanoseconds. Bucket midpoint, capped to the maximum recorded. */
+		double GetPercentile(double Percentile) const;
+	};
+
+	FGeoLatencyHistogram() = default;
+
+	/** Record a call converting NumItems points in LatencyNanoseconds */
+	void Record(uint64 LatencyNanoseconds, int64 NumItems);
+
+	void Reset();
+
+	/** Add the counts of this histogram to Snapshot */
+	void AccumulateTo(FSnapshot& Snapshot) const;
+
+	static int32 GetBucketIndex(uint64 Value);
+	static uint64 GetBucketLowerBound(int32 Index);
+	static uint64 GetBucketWidth(int32 Index);
+
+private:
+	static void AtomicMax(std::atomic<uint64>& Target, uint64 Value);
+
+	std::atomic<uint64> Buckets[NumBuckets] = {};
+	std::atomic<uint64> NumSamples { 0 };
+	std::atomic<uint64> NumItems { 0 };
+	std::atomic<uint64> SumNanoseconds { 0 };
+	std::atomic<uint64> MaxNanoseconds { 0 };
+	std::atomic<uint64> MaxItemNanoseconds { 0 };
+};
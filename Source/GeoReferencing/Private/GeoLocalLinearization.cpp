@@ -0,0 +1,215 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoLocalLinearization.h"
+
+#include "GeographicCoordinates.h"
+#include "GeoReferencingStats.h"
+
+namespace
+{
+	enum class EGeoSpace : uint8
+	{
+		Engine,
+		Projected,
+		Geographic,
+		ECEF
+	};
+
+	void GetSpaces(EGeoConversion Conversion, EGeoSpace& OutSource, EGeoSpace& OutTarget)
+	{
+		switch (Conversion)
+		{
+		case EGeoConversion::EngineToProjected:		OutSource = EGeoSpace::Engine;		OutTarget = EGeoSpace::Projected;	break;
+		case EGeoConversion::ProjectedToEngine:		OutSource = EGeoSpace::Projected;	OutTarget = EGeoSpace::Engine;		break;
+		case EGeoConversion::EngineToGeographic:	OutSource = EGeoSpace::Engine;		OutTarget = EGeoSpace::Geographic;	break;
+		case EGeoConversion::GeographicToEngine:	OutSource = EGeoSpace::Geographic;	OutTarget = EGeoSpace::Engine;		break;
+		case EGeoConversion::EngineToECEF:			OutSource = EGeoSpace::Engine;		OutTarget = EGeoSpace::ECEF;		break;
+		case EGeoConversion::ECEFToEngine:			OutSource = EGeoSpace::ECEF;		OutTarget = EGeoSpace::Engine;		break;
+		case EGeoConversion::ProjectedToGeographic:	OutSource = EGeoSpace::Projected;	OutTarget = EGeoSpace::Geographic;	break;
+		case EGeoConversion::GeographicToProjected:	OutSource = EGeoSpace::Geographic;	OutTarget = EGeoSpace::Projected;	break;
+		case EGeoConversion::ProjectedToECEF:		OutSource = EGeoSpace::Projected;	OutTarget = EGeoSpace::ECEF;		break;
+		case EGeoConversion::ECEFToProjected:		OutSource = EGeoSpace::ECEF;		OutTarget = EGeoSpace::Projected;	break;
+		case EGeoConversion::GeographicToECEF:		OutSource = EGeoSpace::Geographic;	OutTarget = EGeoSpace::ECEF;		break;
+		case EGeoConversion::ECEFToGeographic:
+		default:									OutSource = EGeoSpace::ECEF;		OutTarget = EGeoSpace::Geographic;	break;
+		}
+	}
+
+	// Meters per coordinate unit along each axis, around a location. Projected CRS units are assumed to be meters.
+	FVector GetMetersPerUnit(EGeoSpace Space, const FVector& Location)
+	{
+		// Mean earth radius : the scales only drive the error bound, a sphere is accurate enough for that
+		static constexpr double MetersPerDegree = 6371008.8 * UE_DOUBLE_PI / 180.0;
+
+		switch (Space)
+		{
+		case EGeoSpace::Engine:
+			return FVector(0.01);
+		case EGeoSpace::Geographic:
+			// Clamped to stay invertible near the poles
+			return FVector(MetersPerDegree * FMath::Max(FMath::Cos(FMath::DegreesToRadians(Location.Y)), 0.01), MetersPerDegree, 1.0);
+		default:
+			return FVector::OneVector;
+		}
+	}
+}
+
+FGeoLocalLinearization::FGeoLocalLinearization(AGeoReferencingSystem* InGeoReferencingSystem, EGeoConversion InConversion, const FGeoLocalLinearizationSettings& InSettings)
+	: GeoReferencingSystem(InGeoReferencingSystem)
+	, Conversion(InConversion)
+	, Settings(InSettings)
+{
+	check(Conversion != EGeoConversion::Count);
+	Jacobian[0] = FVector::ZeroVector;
+	Jacobian[1] = FVector::ZeroVector;
+	Jacobian[2] = FVector::ZeroVector;
+}
+
+bool FGeoLocalLinearization::ConvertExact(AGeoReferencingSystem& System, const FVector& Input, FVector& Output) const
+{
+	FGeographicCoordinates Geographic;
+	switch (Conversion)
+	{
+	case EGeoConversion::EngineToProjected:		System.EngineToProjected(Input, Output); break;
+	case EGeoConversion::ProjectedToEngine:		System.ProjectedToEngine(Input, Output); break;
+	case EGeoConversion::EngineToECEF:			System.EngineToECEF(Input, Output); break;
+	case EGeoConversion::ECEFToEngine:			System.ECEFToEngine(Input, Output); break;
+	case EGeoConversion::ProjectedToECEF:		System.ProjectedToECEF(Input, Output); break;
+	case EGeoConversion::ECEFToProjected:		System.ECEFToProjected(Input, Output); break;
+
+	case EGeoConversion::EngineToGeographic:
+	case EGeoConversion::ProjectedToGeographic:
+	case EGeoConversion::ECEFToGeographic:
+		if (Conversion == EGeoConversion::EngineToGeographic)
+		{
+			System.EngineToGeographic(Input, Geographic);
+		}
+		else if (Conversion == EGeoConversion::ProjectedToGeographic)
+		{
+			System.ProjectedToGeographic(Input, Geographic);
+		}
+		else
+		{
+			System.ECEFToGeographic(Input, Geographic);
+		}
+		Output = FVector(Geographic.Longitude, Geographic.Latitude, Geographic.Altitude);
+		break;
+
+	case EGeoConversion::GeographicToEngine:
+	case EGeoConversion::GeographicToProjected:
+	case EGeoConversion::GeographicToECEF:
+		Geographic = FGeographicCoordinates(Input.X, Input.Y, Input.Z);
+		if (Conversion == EGeoConversion::GeographicToEngine)
+		{
+			System.GeographicToEngine(Geographic, Output);
+		}
+		else if (Conversion == EGeoConversion::GeographicToProjected)
+		{
+			System.GeographicToProjected(Geographic, Output);
+		}
+		else
+		{
+			System.GeographicToECEF(Geographic, Output);
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	// PROJ reports points outside of the CRS domain as infinite coordinates
+	return !Output.ContainsNaN() && FMath::IsFinite(Output.X) && FMath::IsFinite(Output.Y) && FMath::IsFinite(Output.Z);
+}
+
+bool FGeoLocalLinearization::Anchor(const FVector& Input)
+{
+	AGeoReferencingSystem* System = GeoReferencingSystem.Get();
+	if (System == nullptr)
+	{
+		bHasAnchor = false;
+		return false;
+	}
+
+	NumAnchors++;
+	GEOREFERENCING_COUNTER_ADD(LinearizationAnchors, 1);
+
+	AnchorInput = Input;
+	bHasAnchor = true;
+	ValidRadiusMeters = 0.0; // Until proven otherwise, every point is converted exactly
+	const bool bAnchorConverted = ConvertExact(*System, Input, AnchorOutput);
+
+	// Read after the conversion, which waits for the initialization of the system
+	AnchorSettingsSerial = System->GetSettingsSerial();
+	if (!bAnchorConverted)
+	{
+		return true;
+	}
+
+	EGeoSpace SourceSpace, TargetSpace;
+	GetSpaces(Conversion, SourceSpace, TargetSpace);
+	InputMetersPerUnit = GetMetersPerUnit(SourceSpace, AnchorInput);
+	const FVector OutputMetersPerUnit = GetMetersPerUnit(TargetSpace, AnchorOutput);
+
+	// Central differences give the Jacobian, and the error of the linear prediction at the probes : half the second difference.
+	// That error grows with the square of the distance, which bounds the valid radius.
+	double MaxCurvature = 0.0;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		FVector Offset = FVector::ZeroVector;
+		Offset[Axis] = Settings.StepMeters / InputMetersPerUnit[Axis];
+
+		FVector Plus, Minus;
+		if (!ConvertExact(*System, Input + Offset, Plus) || !ConvertExact(*System, Input - Offset, Minus))
+		{
+			return true;
+		}
+
+		Jacobian[Axis] = (Plus - Minus) / (2.0 * Offset[Axis]);
+
+		const FVector ProbeError = (Plus - 2.0 * AnchorOutput + Minus) * 0.5 * OutputMetersPerUnit;
+		MaxCurvature = FMath::Max(MaxCurvature, ProbeError.Size() / FMath::Square(Settings.StepMeters));
+	}
+
+	ValidRadiusMeters = MaxCurvature > 0.0 ? FMath::Min(FMath::Sqrt(Settings.MaxErrorMeters / MaxCurvature), Settings.MaxAnchorDistanceMeters) : Settings.MaxAnchorDistanceMeters;
+	return true;
+}
+
+bool FGeoLocalLinearization::Transform(const FVector& Input, FVector& Output)
+{
+	NumTransforms++;
+
+	// The Jacobian was sampled with the previous transforms
+	const AGeoReferencingSystem* System = GeoReferencingSystem.Get();
+	if (bHasAnchor && (System == nullptr || System->GetSettingsSerial() != AnchorSettingsSerial))
+	{
+		bHasAnchor = false;
+	}
+
+	const FVector Delta = Input - AnchorInput;
+	if (bHasAnchor && (Delta * InputMetersPerUnit).SizeSquared() <= FMath::Square(ValidRadiusMeters))
+	{
+		Output = AnchorOutput + Jacobian[0] * Delta.X + Jacobian[1] * Delta.Y + Jacobian[2] * Delta.Z;
+		return true;
+	}
+
+	if (!Anchor(Input))
+	{
+		return false;
+	}
+
+	// The anchor output is exact, unless the point is out of the CRS domain
+	Output = AnchorOutput;
+	return true;
+}
+
+bool FGeoLocalLinearization::Transform(TConstArrayView<FVector> Inputs, TArrayView<FVector> Outputs)
+{
+	check(Inputs.Num() == Outputs.Num());
+
+	bool bSuccess = true;
+	for (int32 Index = 0; Index < Inputs.Num(); ++Index)
+	{
+		bSuccess &= Transform(Inputs[Index], Outputs[Index]);
+	}
+	return bSuccess;
+}
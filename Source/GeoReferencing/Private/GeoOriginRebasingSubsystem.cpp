@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoOriginRebasingSubsystem.h"
+
+#include "GeoReferencingSystem.h"
+#include "GeoReferencingSubsystem.h"
+#include "GeoReferencingModule.h"
+#include "GeoReferencingStats.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/MovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+void UGeoOriginRebasingSubsystem::SetTrackedActor(AActor* Actor)
+{
+	TrackedActor = Actor;
+}
+
+bool UGeoOriginRebasingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Editor worlds keep the origin they were authored with
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UGeoOriginRebasingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGeoOriginRebasingSubsystem, STATGROUP_Tickables);
+}
+
+bool UGeoOriginRebasingSubsystem::GetTrackedLocation(FVector& OutLocation) const
+{
+	if (const AActor* Actor = TrackedActor.Get())
+	{
+		OutLocation = Actor->GetActorLocation();
+		return true;
+	}
+
+	const UWorld* World = GetWorld();
+	const APlayerController* PlayerController = World != nullptr ? World->GetFirstPlayerController() : nullptr;
+	if (PlayerController == nullptr)
+	{
+		return false;
+	}
+	if (PlayerController->PlayerCameraManager != nullptr)
+	{
+		OutLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+		return true;
+	}
+	if (const APawn* Pawn = PlayerController->GetPawn())
+	{
+		OutLocation = Pawn->GetActorLocation();
+		return true;
+	}
+	return false;
+}
+
+void UGeoOriginRebasingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UGeoReferencingSubsystem* GeoReferencingSubsystem = GetWorld()->GetSubsystem<UGeoReferencingSubsystem>();
+	AGeoReferencingSystem* GeoReferencingSystem = GeoReferencingSubsystem != nullptr ? GeoReferencingSubsystem->GetCachedGeoReferencingSystem() : nullptr;
+	if (GeoReferencingSystem == nullptr)
+	{
+		return;
+	}
+
+	FVector TrackedLocation;
+	if (!GeoReferencingSystem->bEnableOriginRebasing || !GeoReferencingSystem->IsReady() || !GetTrackedLocation(TrackedLocation))
+	{
+		return;
+	}
+
+	const double Threshold = GeoReferencingSystem->RebasingPrecisionThresholdCentimeters;
+	const double Spacing = AGeoReferencingSystem::GetSinglePrecisionSpacing(TrackedLocation.GetAbsMax());
+	if (Spacing <= Threshold)
+	{
+		bRebasePostponed = false;
+		return;
+	}
+
+	// Nothing to decide until the spacing doubles
+	const bool bOverdue = Spacing >= 2.0 * Threshold;
+	if (bRebasePostponed && !bOverdue)
+	{
+		return;
+	}
+
+	TArray<AActor*> Actors;
+	const int32 NumStaticActors = GatherActors(*GeoReferencingSystem, Actors);
+
+	// All the actors move in the frame of the rebase. If that doesn't fit in the budget, wait for the precision to degrade further first.
+	const double EstimatedMilliseconds = Actors.Num() * SecondsPerActor * 1000.0;
+	if (!bOverdue && EstimatedMilliseconds > GeoReferencingSystem->RebasingBudgetMilliseconds)
+	{
+		UE_LOG(LogGeoReferencing, Verbose, TEXT("Origin rebasing postponed : moving %d actors should take %.2f ms, over the budget of %.2f ms"), Actors.Num(), EstimatedMilliseconds, GeoReferencingSystem->RebasingBudgetMilliseconds);
+		bRebasePostponed = true;
+		return;
+	}
+
+	UE_LOG(LogGeoReferencing, Verbose, TEXT("Single precision spacing of %g cm at the tracked location, rebasing the origin"), Spacing);
+	bRebasePostponed = false;
+	RebaseActors(*GeoReferencingSystem, TrackedLocation, Actors, NumStaticActors);
+}
+
+bool UGeoOriginRebasingSubsystem::RebaseOriginAt(const FVector& EngineCoordinates)
+{
+	UGeoReferencingSubsystem* GeoReferencingSubsystem = GetWorld()->GetSubsystem<UGeoReferencingSubsystem>();
+	AGeoReferencingSystem* GeoReferencingSystem = GeoReferencingSubsystem != nullptr ? GeoReferencingSubsystem->GetGeoReferencingSystem() : nullptr;
+	if (GeoReferencingSystem == nullptr)
+	{
+		return false;
+	}
+
+	TArray<AActor*> Actors;
+	const int32 NumStaticActors = GatherActors(*GeoReferencingSystem, Actors);
+	bRebasePostponed = false;
+	return RebaseActors(*GeoReferencingSystem, EngineCoordinates, Actors, NumStaticActors);
+}
+
+int32 UGeoOriginRebasingSubsystem::GatherActors(const AGeoReferencingSystem& GeoReferencingSystem, TArray<AActor*>& OutActors) const
+{
+	// Root actors only, attached ones follow their parent
+	int32 NumStaticActors = 0;
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		AActor* Actor = *It;
+		const USceneComponent* RootComponent = Actor->GetRootComponent();
+		if (Actor == &GeoReferencingSystem || RootComponent == nullptr || RootComponent->GetAttachParent() != nullptr || Actor->bIgnoresOriginShifting)
+		{
+			continue;
+		}
+
+		// Static and stationary actors have lighting, navigation and collision baked where they are : they keep their engine location
+		if (RootComponent->Mobility != EComponentMobility::Movable)
+		{
+			++NumStaticActors;
+			continue;
+		}
+		OutActors.Add(Actor);
+	}
+	return NumStaticActors;
+}
+
+bool UGeoOriginRebasingSubsystem::RebaseActors(AGeoReferencingSystem& GeoReferencingSystem, const FVector& EngineCoordinates, const TArray<AActor*>& Actors, int32 NumStaticActors)
+{
+	GEOREFERENCING_SCOPE(OriginRebase);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FTransform OldToNewEngine;
+	if (!GeoReferencingSystem.RebaseOrigin(EngineCoordinates, OldToNewEngine))
+	{
+		return false;
+	}
+
+	// The new transforms only read the actors, compute them in parallel. Listeners of OnOriginRebased may have destroyed some actors meanwhile.
+	TArray<FTransform> NewTransforms;
+	NewTransforms.SetNumUninitialized(Actors.Num());
+	ParallelFor(Actors.Num(), [&Actors, &NewTransforms, &OldToNewEngine](int32 Index)
+	{
+		NewTransforms[Index] = Actors[Index]->GetActorTransform() * OldToNewEngine;
+	});
+
+	// Moving an actor updates its components, overlaps and physics state : that is done on this thread, all in this frame
+	const FQuat Rotation = OldToNewEngine.GetRotation();
+	const bool bRotate = !Rotation.Equals(FQuat::Identity, UE_DOUBLE_KINDA_SMALL_NUMBER);
+	int32 NumMoved = 0;
+	for (int32 Index = 0; Index < Actors.Num(); ++Index)
+	{
+		AActor* Actor = Actors[Index];
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+		Actor->SetActorTransform(NewTransforms[Index], false, nullptr, ETeleportType::TeleportPhysics);
+
+		// Velocities are expressed in the engine frame too
+		if (bRotate)
+		{
+			UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+			if (Primitive != nullptr && Primitive->IsSimulatingPhysics())
+			{
+				Primitive->SetPhysicsLinearVelocity(Rotation.RotateVector(Primitive->GetPhysicsLinearVelocity()));
+				Primitive->SetPhysicsAngularVelocityInDegrees(Rotation.RotateVector(Primitive->GetPhysicsAngularVelocityInDegrees()));
+			}
+			if (UMovementComponent* Movement = Actor->FindComponentByClass<UMovementComponent>())
+			{
+				Movement->Velocity = Rotation.RotateVector(Movement->Velocity);
+			}
+		}
+		++NumMoved;
+	}
+
+	// Views turn with the frame, once their pawns are moved
+	if (bRotate)
+	{
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (APlayerController* PlayerController = It->Get())
+			{
+				PlayerController->SetControlRotation((Rotation * PlayerController->GetControlRotation().Quaternion()).Rotator());
+			}
+		}
+	}
+
+	// The estimate of the next rebases follows the measured time
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	if (NumMoved > 0)
+	{
+		SecondsPerActor = FMath::Lerp(SecondsPerActor, ElapsedSeconds / NumMoved, 0.5);
+	}
+
+	UE_LOG(LogGeoReferencing, Display, TEXT("Origin rebased in %.2f ms, %d actors moved"), ElapsedSeconds * 1000.0, NumMoved);
+	if (NumStaticActors > 0)
+	{
+		UE_LOG(LogGeoReferencing, Log, TEXT("%d static or stationary actors kept their engine location, make them movable to keep their geographic location across rebases"), NumStaticActors);
+	}
+	return true;
+}
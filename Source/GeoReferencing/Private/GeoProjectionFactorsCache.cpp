@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoProjectionFactorsCache.h"
+
+void FGeoProjectionFactorsCache::Configure(double InCellSizeDegrees)
+{
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	CellSizeDegrees = FMath::Max(0.0, InCellSizeDegrees);
+	Entries.Empty(IsEnabled() ? NumSlots : 0);
+	if (IsEnabled())
+	{
+		Entries.SetNum(NumSlots);
+	}
+	Invalidate();
+}
+
+void FGeoProjectionFactorsCache::GetCell(const FGeographicCoordinates& GeographicCoordinates, int64& OutCellX, int64& OutCellY, FGeographicCoordinates& OutCellCenter) const
+{
+	check(IsEnabled());
+	OutCellX = static_cast<int64>(FMath::FloorToDouble(GeographicCoordinates.Longitude / CellSizeDegrees));
+	OutCellY = static_cast<int64>(FMath::FloorToDouble(GeographicCoordinates.Latitude / CellSizeDegrees));
+
+	OutCellCenter.Longitude = (static_cast<double>(OutCellX) + 0.5) * CellSizeDegrees;
+	OutCellCenter.Latitude = FMath::Clamp((static_cast<double>(OutCellY) + 0.5) * CellSizeDegrees, -90.0, 90.0);
+	OutCellCenter.Altitude = 0.0; // Factors do not depend on the altitude
+}
+
+uint32 FGeoProjectionFactorsCache::GetSlot(int64 CellX, int64 CellY)
+{
+	// Neighbouring cells land in different slots, a moving viewer keeps its recent cells around
+	const uint64 Hash = (static_cast<uint64>(CellX) * 0x9E3779B97F4A7C15ull) ^ (static_cast<uint64>(CellY) * 0xC2B2AE3D27D4EB4Full);
+	return static_cast<uint32>(Hash >> 32) & (NumSlots - 1);
+}
+
+bool FGeoProjectionFactorsCache::Find(int64 CellX, int64 CellY, FGeoProjectionFactors& OutFactors, uint32& OutGeneration)
+{
+	const uint32 CurrentGeneration = Generation.load(std::memory_order_acquire);
+	OutGeneration = CurrentGeneration;
+
+	FRWScopeLock ScopeLock(Lock, SLT_ReadOnly);
+	if (Entries.Num() == 0)
+	{
+		return false;
+	}
+
+	const FEntry& Entry = Entries[GetSlot(CellX, CellY)];
+	if (Entry.Generation == CurrentGeneration && Entry.CellX == CellX && Entry.CellY == CellY)
+	{
+		OutFactors = Entry.Factors;
+		return true;
+	}
+	return false;
+}
+
+void FGeoProjectionFactorsCache::Add(int64 CellX, int64 CellY, const FGeoProjectionFactors& Factors, uint32 InGeneration)
+{
+	FRWScopeLock ScopeLock(Lock, SLT_Write);
+	if (Entries.Num() > 0 && InGeneration == Generation.load(std::memory_order_acquire))
+	{
+		FEntry& Entry = Entries[GetSlot(CellX, CellY)];
+		Entry.CellX = CellX;
+		Entry.CellY = CellY;
+		Entry.Generation = InGeneration;
+		Entry.Factors = Factors;
+	}
+}
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+#include "GeoReferencingSystem.h"
+
+#include <atomic>
+
+/**
+ * Projection factors computed once per cell of a regular longitude / latitude grid.
+ * Convergence and scale vary slowly over the projection, so every location of a cell is given the factors of the cell center.
+ * Like FGeoCoordinateCache, the table is direct mapped and Invalidate() only bumps a generation stamp.
+ */
+class FGeoProjectionFactorsCache
+{
+public:
+	FGeoProjectionFactorsCache() = default;
+
+	/** Set the cell size in degrees, 0 disables the cache. Drops all the entries. */
+	void Configure(double InCellSizeDegrees);
+
+	/** Drop all the entries */
+	void Invalidate() { Generation.fetch_add(1, std::memory_order_release); }
+
+	bool IsEnabled() const { return CellSizeDegrees > 0.0; }
+
+	/** Cell holding a location, and the location the factors of that cell are computed at */
+	void GetCell(const FGeographicCoordinates& GeographicCoordinates, int64& OutCellX, int64& OutCellY, FGeographicCoordinates& OutCellCenter) const;
+
+	/** On a miss, OutGeneration is the generation to add the factors with, as in FGeoCoordinateCache */
+	bool Find(int64 CellX, int64 CellY, FGeoProjectionFactors& OutFactors, uint32& OutGeneration);
+	void Add(int64 CellX, int64 CellY, const FGeoProjectionFactors& Factors, uint32 InGeneration);
+
+private:
+	static constexpr int32 NumSlots = 1024;
+
+	struct FEntry
+	{
+		int64 CellX = 0;
+		int64 CellY = 0;
+		uint32 Generation = 0; // 0 is never a valid generation
+		FGeoProjectionFactors Factors;
+	};
+
+	static uint32 GetSlot(int64 CellX, int64 CellY);
+
+	FRWLock Lock;
+	TArray<FEntry> Entries;
+	double CellSizeDegrees = 0.0;
+	std::atomic<uint32> Generation { 1 };
+};
@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingStats.h"
+
+DEFINE_STAT(STAT_GeoReferencing_BatchTransform);
+DEFINE_STAT(STAT_GeoReferencing_StreamingTransform);
+DEFINE_STAT(STAT_GeoReferencing_BuildApproximation);
+DEFINE_STAT(STAT_GeoReferencing_EngineToProjected);
+DEFINE_STAT(STAT_GeoReferencing_ProjectedToEngine);
+DEFINE_STAT(STAT_GeoReferencing_EngineToECEF);
+DEFINE_STAT(STAT_GeoReferencing_ECEFToEngine);
+DEFINE_STAT(STAT_GeoReferencing_EngineToGeographic);
+DEFINE_STAT(STAT_GeoReferencing_GeographicToEngine);
+DEFINE_STAT(STAT_GeoReferencing_ProjectedToGeographic);
+DEFINE_STAT(STAT_GeoReferencing_GeographicToProjected);
+DEFINE_STAT(STAT_GeoReferencing_ProjectedToECEF);
+DEFINE_STAT(STAT_GeoReferencing_ECEFToProjected);
+DEFINE_STAT(STAT_GeoReferencing_GeographicToECEF);
+DEFINE_STAT(STAT_GeoReferencing_ECEFToGeographic);
+
+DEFINE_STAT(STAT_GeoReferencing_ApplySettings);
+DEFINE_STAT(STAT_GeoReferencing_InitPROJLibrary);
+DEFINE_STAT(STAT_GeoReferencing_GetPROJProjection);
+DEFINE_STAT(STAT_GeoReferencing_GetEllipsoid);
+DEFINE_STAT(STAT_GeoReferencing_CreateWorkerContext);
+DEFINE_STAT(STAT_GeoReferencing_OriginRebase);
+
+DEFINE_STAT(STAT_GeoReferencing_PointsConverted);
+DEFINE_STAT(STAT_GeoReferencing_PipelinesBuilt);
+DEFINE_STAT(STAT_GeoReferencing_ProjDatabaseQueries);
+DEFINE_STAT(STAT_GeoReferencing_LinearizationAnchors);
+
+UE_TRACE_CHANNEL_DEFINE(GeoReferencingChannel);
+
+TRACE_DECLARE_INT_COUNTER(GeoReferencing_PointsConverted, TEXT("GeoReferencing/PointsConverted"));
+TRACE_DECLARE_INT_COUNTER(GeoReferencing_PipelinesBuilt, TEXT("GeoReferencing/PipelinesBuilt"));
+TRACE_DECLARE_INT_COUNTER(GeoReferencing_ProjDatabaseQueries, TEXT("GeoReferencing/ProjDatabaseQueries"));
+TRACE_DECLARE_INT_COUNTER(GeoReferencing_LinearizationAnchors, TEXT("GeoReferencing/LinearizationAnchors"));
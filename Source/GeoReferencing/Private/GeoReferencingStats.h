@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+// Stats group : "stat GeoReferencing"
+DECLARE_STATS_GROUP(TEXT("GeoReferencing"), STATGROUP_GeoReferencing, STATCAT_Advanced);
+
+// Conversions
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Batch Transform"), STAT_GeoReferencing_BatchTransform, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Streaming Transform"), STAT_GeoReferencing_StreamingTransform, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Build Approximation"), STAT_GeoReferencing_BuildApproximation, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Engine To Projected"), STAT_GeoReferencing_EngineToProjected, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projected To Engine"), STAT_GeoReferencing_ProjectedToEngine, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Engine To ECEF"), STAT_GeoReferencing_EngineToECEF, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ECEF To Engine"), STAT_GeoReferencing_ECEFToEngine, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Engine To Geographic"), STAT_GeoReferencing_EngineToGeographic, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Geographic To Engine"), STAT_GeoReferencing_GeographicToEngine, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projected To Geographic"), STAT_GeoReferencing_ProjectedToGeographic, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Geographic To Projected"), STAT_GeoReferencing_GeographicToProjected, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projected To ECEF"), STAT_GeoReferencing_ProjectedToECEF, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ECEF To Projected"), STAT_GeoReferencing_ECEFToProjected, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Geographic To ECEF"), STAT_GeoReferencing_GeographicToECEF, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ECEF To Geographic"), STAT_GeoReferencing_ECEFToGeographic, STATGROUP_GeoReferencing, );
+
+// Setup
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Settings"), STAT_GeoReferencing_ApplySettings, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Init PROJ Library"), STAT_GeoReferencing_InitPROJLibrary, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Get PROJ Projection"), STAT_GeoReferencing_GetPROJProjection, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Get Ellipsoid"), STAT_GeoReferencing_GetEllipsoid, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Create Worker Context"), STAT_GeoReferencing_CreateWorkerContext, STATGROUP_GeoReferencing, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Origin Rebase"), STAT_GeoReferencing_OriginRebase, STATGROUP_GeoReferencing, );
+
+// Counters. Points are counted by the batch functions, single point calls show in the call counts of their cycle stat.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Points Converted"), STAT_GeoReferencing_PointsConverted, STATGROUP_GeoReferencing, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pipelines Built"), STAT_GeoReferencing_PipelinesBuilt, STATGROUP_GeoReferencing, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("PROJ Database Queries"), STAT_GeoReferencing_ProjDatabaseQueries, STATGROUP_GeoReferencing, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Linearization Anchors"), STAT_GeoReferencing_LinearizationAnchors, STATGROUP_GeoReferencing, );
+
+// Insights : enable with -trace=cpu,counters,GeoReferencing
+UE_TRACE_CHANNEL_EXTERN(GeoReferencingChannel);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(GeoReferencing_PointsConverted);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GeoReferencing_PipelinesBuilt);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GeoReferencing_ProjDatabaseQueries);
+TRACE_DECLARE_INT_COUNTER_EXTERN(GeoReferencing_LinearizationAnchors);
+
+// Cycle stat and Insights CPU event on the GeoReferencing channel, for the scope
+#define GEOREFERENCING_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_GeoReferencing_##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(GeoReferencing_##Name, GeoReferencingChannel)
+
+// Increment a counter in both the stats system and the trace
+#define GEOREFERENCING_COUNTER_ADD(Name, Value) \
+	INC_DWORD_STAT_BY(STAT_GeoReferencing_##Name, Value); \
+	TRACE_COUNTER_ADD(GeoReferencing_##Name, Value)
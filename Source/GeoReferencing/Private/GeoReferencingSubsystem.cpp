@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingSubsystem.h"
+
+#include "GeoReferencingSystem.h"
+#include "GeoReferencingModule.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UGeoReferencingSubsystem* UGeoReferencingSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		return World->GetSubsystem<UGeoReferencingSubsystem>();
+	}
+	return nullptr;
+}
+
+AGeoReferencingSystem* UGeoReferencingSubsystem::GetGeoReferencingSystem() const
+{
+	const int32 NbActors = GeoReferencingSystems.Num();
+	if (NbActors == 0)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("GeoReferencingSystem actor not found. Please add one to your world to configure your geo referencing system."));
+	}
+	else if (NbActors > 1)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("Multiple GeoReferencingSystem actors found. Only one actor should be used to configure your geo referencing system"));
+	}
+
+	return CachedGeoReferencingSystem;
+}
+
+void UGeoReferencingSubsystem::RegisterGeoReferencingSystem(AGeoReferencingSystem* GeoReferencingSystem)
+{
+	if (GeoReferencingSystem != nullptr && !GeoReferencingSystem->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		GeoReferencingSystems.AddUnique(GeoReferencingSystem);
+		UpdateCachedGeoReferencingSystem();
+	}
+}
+
+void UGeoReferencingSubsystem::UnregisterGeoReferencingSystem(AGeoReferencingSystem* GeoReferencingSystem)
+{
+	GeoReferencingSystems.Remove(GeoReferencingSystem);
+	UpdateCachedGeoReferencingSystem();
+}
+
+void UGeoReferencingSubsystem::Deinitialize()
+{
+	GeoReferencingSystems.Empty();
+	CachedGeoReferencingSystem = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UGeoReferencingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Blueprint editors and thumbnails can host a GeoReferencingSystem too
+	return Super::DoesSupportWorldType(WorldType) || WorldType == EWorldType::EditorPreview || WorldType == EWorldType::GamePreview;
+}
+
+void UGeoReferencingSubsystem::UpdateCachedGeoReferencingSystem()
+{
+	// References to destroyed actors are cleared by the garbage collector
+	GeoReferencingSystems.Remove(nullptr);
+	CachedGeoReferencingSystem = GeoReferencingSystems.Num() == 1 ? GeoReferencingSystems[0] : nullptr;
+}
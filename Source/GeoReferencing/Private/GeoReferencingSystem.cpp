@@ -1,11 +1,12 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "GeoReferencingSystem.h"
+#include "GeoReferencingSubsystem.h"
+#include "GeoTransformerSnapshot.h"
 
 #include "GameFramework/WorldSettings.h"
 #include "Interfaces/IPluginManager.h"
 #include "Ellipsoid.h"
-#include "Kismet/GameplayStatics.h"
 #include "GeoReferencingModule.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
@@ -13,12 +14,21 @@
 #include "HAL/FileManager.h"
 #include "HAL/PlatformFileManager.h"
 #include "GeographicCoordinates.h"
+#include "GeoTransformKernels.h"
+#include "GeoCoordinateBuffer.h"
+#include "GeoCoordinateCache.h"
+#include "GeoProjectionFactorsCache.h"
+#include "TransverseMercator.h"
+#include "GeoApproximateTransformer.h"
+#include "GeoLatencyHistogram.h"
+#include "GeoReferencingStats.h"
 #include "MathUtil.h"
 #include "Components/BillboardComponent.h"
  
 #if WITH_EDITOR
 
 #include "UObject/ConstructorHelpers.h"
+#include "UObject/ObjectSaveContext.h"
 #include "Engine/Texture2D.h"
 
 #endif
@@ -28,16 +38,18 @@
 #include "proj.h"
 #include "HAL/PlatformTime.h"
 #include "HAL/CriticalSection.h"
+#include "HAL/Event.h"
 #include "Misc/ScopeLock.h"
 #include "Async/ParallelFor.h"
-#include "Stats/Stats.h"
+#include "Async/Async.h"
+#include "LatentActions.h"
+#include "Engine/World.h"
+#include "Containers/LruCache.h"
+#include "Misc/Optional.h"
 
 THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 
-// Stat declarations
-DECLARE_CYCLE_STAT(TEXT("GeoReferencing Batch Transform"), STAT_GeoReferencingBatchTransform, STATGROUP_Game);
-
 #define ECEF_EPSG_FSTRING FString(TEXT("EPSG:4978"))
 
 // LWC_TODO - To be replaced once FVector::Normalize will use a smaller number than 1e-8
@@ -79,28 +91,374 @@ AGeoReferencingSystem::AGeoReferencingSystem(const FObjectInitializer& ObjectIni
 
 AGeoReferencingSystem* AGeoReferencingSystem::GetGeoReferencingSystem(UObject* WorldContextObject)
 {
-	AGeoReferencingSystem* Actor = nullptr;
+	if (UGeoReferencingSubsystem* Subsystem = UGeoReferencingSubsystem::Get(WorldContextObject))
+	{
+		return Subsystem->GetGeoReferencingSystem();
+	}
+	return nullptr;
+}
+
+void AGeoReferencingSystem::PostRegisterAllComponents()
+{
+	Super::PostRegisterAllComponents();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UGeoReferencingSubsystem* Subsystem = World->GetSubsystem<UGeoReferencingSubsystem>())
+		{
+			Subsystem->RegisterGeoReferencingSystem(this);
+		}
+	}
+}
+
+void AGeoReferencingSystem::PostUnregisterAllComponents()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UGeoReferencingSubsystem* Subsystem = World->GetSubsystem<UGeoReferencingSubsystem>())
+		{
+			Subsystem->UnregisterGeoReferencingSystem(this);
+		}
+	}
+
+	Super::PostUnregisterAllComponents();
+}
+
+// The set of PROJ pipelines used by the conversions, all bound to the same PJ_CONTEXT.
+struct FProjPipelines
+{
+	PJ* ProjectedToGeographic = nullptr;
+	PJ* ProjectedToECEF = nullptr;
+	PJ* GeographicToECEF = nullptr;
+};
+
+// PROJ objects must never be used by two threads at the same time. Each worker of a parallel batch
+// leases one of these: a private PJ_CONTEXT holding clones of the main pipelines.
+class FProjWorkerContext
+{
+public:
+	~FProjWorkerContext();
+
+	PJ_CONTEXT* Context = nullptr;
+	FProjPipelines Pipelines;
+	PJ* ProjectedCRS = nullptr; // For proj_factors, null if the projected CRS is not a projection
+	uint32 Generation = 0; // Value of FGeoReferencingSystemInternals::PipelinesGeneration when cloned
+};
+
+FProjWorkerContext::~FProjWorkerContext()
+{
+	for (PJ* Pipeline : { Pipelines.ProjectedToGeographic, Pipelines.ProjectedToECEF, Pipelines.GeographicToECEF, ProjectedCRS })
+	{
+		if (Pipeline != nullptr)
+		{
+			proj_destroy(Pipeline);
+		}
+	}
+	if (Context != nullptr)
+	{
+		proj_context_destroy(Context);
+	}
+}
+
+// PROJ pipeline between an arbitrary pair of CRS, with its accuracy metadata, kept in the CRS pairs registry
+class FCRSPairTransform
+{
+public:
+	~FCRSPairTransform()
+	{
+		if (Pipeline != nullptr)
+		{
+			proj_destroy(Pipeline);
+		}
+	}
+
+	PJ* Pipeline = nullptr;
+	FTransformationAccuracy Accuracy;
+};
+
+// Logging, data search path and file API of a PROJ context
+static void ConfigurePROJContextWithDataPath(PJ_CONTEXT* Context, const FString& ProjDataPath);
+
+// Everything the batch kernels read besides the PROJ pipelines, captured by ApplySettings.
+// The origin modes are folded in the affine transforms, the planet shape and the native conversions are template parameters of the kernels.
+struct FGeoStreamKernelConstants
+{
+	FGeoAffineTransform EngineToECEF; // Round Planet
+	FGeoAffineTransform ECEFToEngine; // Round Planet
+	FGeoAffineTransform EngineToProjected; // Flat Planet
+	FGeoAffineTransform ProjectedToEngine; // Flat Planet
+	FEllipsoid GeographicEllipsoid;
+	FTransverseMercator TransverseMercator;
+};
+
+// In place conversion of a chunk of streams, for one conversion and one set of settings
+using FGeoStreamKernel = void (*)(const FGeoStreamKernelConstants& Constants, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams);
+
+namespace GeoStreamKernels
+{
+	// Stages
+
+	void PROJ(PJ* Pipeline, PJ_DIRECTION Direction, const FGeoCoordinateStreams& Streams)
+	{
+		const size_t Count = static_cast<size_t>(Streams.Num);
+		proj_trans_generic(Pipeline, Direction, Streams.X, Streams.Stride, Count, Streams.Y, Streams.Stride, Count, Streams.Z, Streams.Stride, Count, nullptr, 0, 0);
+	}
+
+	template<bool bNativeGeographicToECEF>
+	void GeographicToECEF(const FGeoStreamKernelConstants& Constants, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
+	{
+		if constexpr (bNativeGeographicToECEF)
+		{
+			const FEllipsoid& Ellipsoid = Constants.GeographicEllipsoid;
+			for (int32 i = 0; i < Streams.Num; ++i)
+			{
+				Streams.SetVector(i, Ellipsoid.GeographicToECEF(FGeographicCoordinates(Streams.GetX(i), Streams.GetY(i), Streams.GetZ(i))));
+			}
+		}
+		else
+		{
+			PROJ(Pipelines.GeographicToECEF, PJ_FWD, Streams);
+		}
+	}
+
+	template<bool bNativeGeographicToECEF>
+	void ECEFToGeographic(const FGeoStreamKernelConstants& Constants, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
+	{
+		if constexpr (bNativeGeographicToECEF)
+		{
+			const FEllipsoid& Ellipsoid = Constants.GeographicEllipsoid;
+			for (int32 i = 0; i < Streams.Num; ++i)
+			{
+				const FGeographicCoordinates Geographic = Ellipsoid.ECEFToGeographic(Streams.GetVector(i));
+				Streams.SetVector(i, FVector(Geographic.Longitude, Geographic.Latitude, Geographic.Altitude));
+			}
+		}
+		else
+		{
+			PROJ(Pipelines.GeographicToECEF, PJ_INV, Streams);
+		}
+	}
 
-	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	template<bool bNativeTransverseMercator>
+	void ProjectedToGeographic(const FGeoStreamKernelConstants& Constants, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
 	{
-		TArray<AActor*> Actors;
-		UGameplayStatics::GetAllActorsOfClass(World, AGeoReferencingSystem::StaticClass(), Actors);
-		int NbActors = Actors.Num();
-		if (NbActors == 0)
+		if constexpr (bNativeTransverseMercator)
+		{
+			const FTransverseMercator& TransverseMercator = Constants.TransverseMercator;
+			for (int32 i = 0; i < Streams.Num; ++i)
+			{
+				const FGeographicCoordinates Geographic = TransverseMercator.ProjectedToGeographic(Streams.GetVector(i));
+				Streams.SetVector(i, FVector(Geographic.Longitude, Geographic.Latitude, Geographic.Altitude));
+			}
+		}
+		else
 		{
-			UE_LOG(LogGeoReferencing, Error, TEXT("GeoReferencingSystem actor not found. Please add one to your world to configure your geo referencing system."));
+			PROJ(Pipelines.ProjectedToGeographic, PJ_FWD, Streams);
 		}
-		else if (NbActors > 1)
+	}
+
+	template<bool bNativeTransverseMercator>
+	void GeographicToProjected(const FGeoStreamKernelConstants& Constants, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
+	{
+		if constexpr (bNativeTransverseMercator)
 		{
-			UE_LOG(LogGeoReferencing, Error, TEXT("Multiple GeoReferencingSystem actors found. Only one actor should be used to configure your geo referencing system"));
+			const FTransverseMercator& TransverseMercator = Constants.TransverseMercator;
+			for (int32 i = 0; i < Streams.Num; ++i)
+			{
+				Streams.SetVector(i, TransverseMercator.GeographicToProjected(FGeographicCoordinates(Streams.GetX(i), Streams.GetY(i), Streams.GetZ(i))));
+			}
 		}
 		else
 		{
-			Actor = Cast<AGeoReferencingSystem>(Actors[0]);
+			PROJ(Pipelines.ProjectedToGeographic, PJ_INV, Streams);
+		}
+	}
+
+	// Conversions. Same paths as the single point functions : RoundPlanet goes through ECEF, FlatPlanet through the Projected CRS
+
+	template<EGeoConversion Conversion, bool bRoundPlanet, bool bNativeGeographicToECEF, bool bNativeTransverseMercator>
+	void Transform(const FGeoStreamKernelConstants& Constants, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
+	{
+		if (Streams.Num <= 0)
+		{
+			return;
+		}
+
+		if constexpr (Conversion == EGeoConversion::EngineToProjected)
+		{
+			if constexpr (bRoundPlanet)
+			{
+				GeoTransformKernels::TransformPositions(Constants.EngineToECEF, Streams);
+				PROJ(Pipelines.ProjectedToECEF, PJ_INV, Streams);
+			}
+			else
+			{
+				GeoTransformKernels::TransformPositions(Constants.EngineToProjected, Streams);
+			}
+		}
+		else if constexpr (Conversion == EGeoConversion::ProjectedToEngine)
+		{
+			if constexpr (bRoundPlanet)
+			{
+				PROJ(Pipelines.ProjectedToECEF, PJ_FWD, Streams);
+				GeoTransformKernels::TransformPositions(Constants.ECEFToEngine, Streams);
+			}
+			else
+			{
+				GeoTransformKernels::TransformPositions(Constants.ProjectedToEngine, Streams);
+			}
+		}
+		else if constexpr (Conversion == EGeoConversion::EngineToGeographic)
+		{
+			if constexpr (bRoundPlanet)
+			{
+				GeoTransformKernels::TransformPositions(Constants.EngineToECEF, Streams);
+				ECEFToGeographic<bNativeGeographicToECEF>(Constants, Pipelines, Streams);
+			}
+			else
+			{
+				GeoTransformKernels::TransformPositions(Constants.EngineToProjected, Streams);
+				ProjectedToGeographic<bNativeTransverseMercator>(Constants, Pipelines, Streams);
+			}
+		}
+		else if constexpr (Conversion == EGeoConversion::GeographicToEngine)
+		{
+			if constexpr (bRoundPlanet)
+			{
+				GeographicToECEF<bNativeGeographicToECEF>(Constants, Pipelines, Streams);
+				GeoTransformKernels::TransformPositions(Constants.ECEFToEngine, Streams);
+			}
+			else
+			{
+				GeographicToProjected<bNativeTransverseMercator>(Constants, Pipelines, Streams);
+				GeoTransformKernels::TransformPositions(Constants.ProjectedToEngine, Streams);
+			}
+		}
+		else if constexpr (Conversion == EGeoConversion::EngineToECEF)
+		{
+			if constexpr (bRoundPlanet)
+			{
+				GeoTransformKernels::TransformPositions(Constants.EngineToECEF, Streams);
+			}
+			else
+			{
+				GeoTransformKernels::TransformPositions(Constants.EngineToProjected, Streams);
+				PROJ(Pipelines.ProjectedToECEF, PJ_FWD, Streams);
+			}
+		}
+		else if constexpr (Conversion == EGeoConversion::ECEFToEngine)
+		{
+			if constexpr (bRoundPlanet)
+			{
+				GeoTransformKernels::TransformPositions(Constants.ECEFToEngine, Streams);
+			}
+			else
+			{
+				PROJ(Pipelines.ProjectedToECEF, PJ_INV, Streams);
+				GeoTransformKernels::TransformPositions(Constants.ProjectedToEngine, Streams);
+			}
+		}
+		else if constexpr (Conversion == EGeoConversion::ProjectedToGeographic)
+		{
+			ProjectedToGeographic<bNativeTransverseMercator>(Constants, Pipelines, Streams);
+		}
+		else if constexpr (Conversion == EGeoConversion::GeographicToProjected)
+		{
+			GeographicToProjected<bNativeTransverseMercator>(Constants, Pipelines, Streams);
+		}
+		else if constexpr (Conversion == EGeoConversion::ProjectedToECEF)
+		{
+			PROJ(Pipelines.ProjectedToECEF, PJ_FWD, Streams);
+		}
+		else if constexpr (Conversion == EGeoConversion::ECEFToProjected)
+		{
+			PROJ(Pipelines.ProjectedToECEF, PJ_INV, Streams);
+		}
+		else if constexpr (Conversion == EGeoConversion::GeographicToECEF)
+		{
+			GeographicToECEF<bNativeGeographicToECEF>(Constants, Pipelines, Streams);
+		}
+		else if constexpr (Conversion == EGeoConversion::ECEFToGeographic)
+		{
+			ECEFToGeographic<bNativeGeographicToECEF>(Constants, Pipelines, Streams);
 		}
 	}
 
-	return Actor;
+	template<bool bRoundPlanet, bool bNativeGeographicToECEF, bool bNativeTransverseMercator>
+	void MakeKernels(FGeoStreamKernel (&OutKernels)[static_cast<int32>(EGeoConversion::Count)])
+	{
+		OutKernels[static_cast<int32>(EGeoConversion::EngineToProjected)] = &Transform<EGeoConversion::EngineToProjected, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::ProjectedToEngine)] = &Transform<EGeoConversion::ProjectedToEngine, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::EngineToGeographic)] = &Transform<EGeoConversion::EngineToGeographic, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::GeographicToEngine)] = &Transform<EGeoConversion::GeographicToEngine, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::EngineToECEF)] = &Transform<EGeoConversion::EngineToECEF, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::ECEFToEngine)] = &Transform<EGeoConversion::ECEFToEngine, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::ProjectedToGeographic)] = &Transform<EGeoConversion::ProjectedToGeographic, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::GeographicToProjected)] = &Transform<EGeoConversion::GeographicToProjected, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::ProjectedToECEF)] = &Transform<EGeoConversion::ProjectedToECEF, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::ECEFToProjected)] = &Transform<EGeoConversion::ECEFToProjected, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::GeographicToECEF)] = &Transform<EGeoConversion::GeographicToECEF, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+		OutKernels[static_cast<int32>(EGeoConversion::ECEFToGeographic)] = &Transform<EGeoConversion::ECEFToGeographic, bRoundPlanet, bNativeGeographicToECEF, bNativeTransverseMercator>;
+	}
+}
+
+struct AGeoReferencingSystem::FAppliedSettings
+{
+	EPlanetShape PlanetShape = EPlanetShape::RoundPlanet;
+	FString ProjectedCRS;
+	FString GeographicCRS;
+
+	bool bOriginAtPlanetCenter = false;
+	bool bOriginLocationInProjectedCRS = true;
+	double OriginLatitude = 0.0;
+	double OriginLongitude = 0.0;
+	double OriginAltitude = 0.0;
+	double OriginProjectedCoordinatesEasting = 0.0;
+	double OriginProjectedCoordinatesNorthing = 0.0;
+	double OriginProjectedCoordinatesUp = 0.0;
+
+	bool bUseNativeConversions = false;
+	double NativeConversionToleranceMeters = 0.0;
+	bool bUseCoordinateCache = false;
+	int32 CoordinateCacheSize = 0;
+	bool bUseProjectionFactorsCache = false;
+	double ProjectionFactorsCacheCellSize = 0.0;
+
+	bool bUseLocalFrameGrid = false;
+	double LocalFrameGridCellSizeDegrees = 1.0;
+	double LocalFrameGridMinLongitude = 0.0;
+	double LocalFrameGridMaxLongitude = 0.0;
+	double LocalFrameGridMinLatitude = 0.0;
+	double LocalFrameGridMaxLatitude = 0.0;
+};
+
+AGeoReferencingSystem::FAppliedSettings AGeoReferencingSystem::CaptureSettings() const
+{
+	FAppliedSettings Settings;
+	Settings.PlanetShape = PlanetShape;
+	Settings.ProjectedCRS = ProjectedCRS;
+	Settings.GeographicCRS = GeographicCRS;
+	Settings.bOriginAtPlanetCenter = bOriginAtPlanetCenter;
+	Settings.bOriginLocationInProjectedCRS = bOriginLocationInProjectedCRS;
+	Settings.OriginLatitude = OriginLatitude;
+	Settings.OriginLongitude = OriginLongitude;
+	Settings.OriginAltitude = OriginAltitude;
+	Settings.OriginProjectedCoordinatesEasting = OriginProjectedCoordinatesEasting;
+	Settings.OriginProjectedCoordinatesNorthing = OriginProjectedCoordinatesNorthing;
+	Settings.OriginProjectedCoordinatesUp = OriginProjectedCoordinatesUp;
+	Settings.bUseNativeConversions = bUseNativeConversions;
+	Settings.NativeConversionToleranceMeters = NativeConversionToleranceMeters;
+	Settings.bUseCoordinateCache = bUseCoordinateCache;
+	Settings.CoordinateCacheSize = CoordinateCacheSize;
+	Settings.bUseProjectionFactorsCache = bUseProjectionFactorsCache;
+	Settings.ProjectionFactorsCacheCellSize = ProjectionFactorsCacheCellSize;
+	Settings.bUseLocalFrameGrid = bUseLocalFrameGrid;
+	Settings.LocalFrameGridCellSizeDegrees = LocalFrameGridCellSizeDegrees;
+	Settings.LocalFrameGridMinLongitude = LocalFrameGridMinLongitude;
+	Settings.LocalFrameGridMaxLongitude = LocalFrameGridMaxLongitude;
+	Settings.LocalFrameGridMinLatitude = LocalFrameGridMinLatitude;
+	Settings.LocalFrameGridMaxLatitude = LocalFrameGridMaxLatitude;
+	return Settings;
 }
 
 class AGeoReferencingSystem::FGeoReferencingSystemInternals
@@ -111,24 +469,131 @@ public:
 		, ProjProjectedToGeographic(nullptr)
 		, ProjProjectedToECEF(nullptr)
 		, ProjGeographicToECEF(nullptr)
+		, ProjProjectedCRS(nullptr)
 	{
+		NoAsyncBatchesEvent->Trigger();
 	}
 
+	// Block until the asynchronous initialization is complete, if one is running. Does nothing on the initializing thread itself.
+	void WaitForInitialization() const;
+
 	// Private PROJ Utilities
 	void InitPROJLibrary();
 	void DeInitPROJLibrary();
-	PJ* GetPROJProjection(FString SourceCRS, FString DestinationCRS);
+	void ConfigurePROJContext(PJ_CONTEXT* Context);
+	// Pipeline created on Context, ProjContext if null
+	PJ* GetPROJProjection(FString SourceCRS, FString DestinationCRS, PJ_CONTEXT* Context = nullptr);
+	PJ* GetPROJProjectedCRS(const FString& ProjectedCRS);
+
+	// Instantiate the batch kernels for the planet shape, the native conversions and the transforms in use. Called at the end of ApplySettings.
+	void SelectStreamKernels(bool bRoundPlanet);
+
+	// Build a snapshot of the current state and make it the one returned by GetTransformerSnapshot. Called by ApplySettings and RebaseOrigin, never concurrently.
+	// bKeepPipelines : the pipelines didn't change since the previous snapshot, which shares its PROJ contexts with the new one.
+	void PublishSnapshot(EPlanetShape PlanetShape, const FString& ProjectedCRS, const FString& GeographicCRS, bool bKeepPipelines);
+	void ReleaseSnapshots();
 	bool GetEllipsoid(FString CRSString, FEllipsoid& Ellipsoid);
 	
 	FMatrix GetWorldFrameToECEFFrame(const FEllipsoid& Ellipsoid, const FVector& ECEFLocation);
 
+	// Projection factors through ProjectionFactorsCache. ProjectedCRS is ProjProjectedCRS, or its clone on a worker context.
+	bool GetProjectionFactors(PJ* ProjectedCRS, const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors);
+
+	// Local frames grid. Build is called by ApplySettings once the kernels are selected, and only rebuilds the grid when its settings or the Geographic CRS changed.
+	// FindLocalFrameCell returns INDEX_NONE outside of the grid.
+	void BuildLocalFrameGrid(const FAppliedSettings& AppliedSettings);
+	FGeographicCoordinates GetLocalFrameCellCenter(int32 CellId) const;
+	int32 FindLocalFrameCell(double Longitude, double Latitude) const;
+	FVector ECEFToLocalFrame(int32 CellId, const FVector& ECEFCoordinates) const;
+	FVector LocalFrameToECEF(int32 CellId, const FVector& LocalCoordinates) const;
+
+	// Worker contexts pool. Can be called from any thread : new contexts are cloned from SourceWorkerContext, never from the main pipelines.
+	// Leased contexts are used without any lock, each one by a single worker. 
+	bool AcquireWorkerContexts(int32 NumWorkers, TArray<TUniquePtr<FProjWorkerContext>>& OutWorkerContexts);
+	void ReleaseWorkerContexts(TArray<TUniquePtr<FProjWorkerContext>>& WorkerContexts);
+	void InvalidateWorkerContexts();
+
+	// Clone the main pipelines in SourceWorkerContext. Called by ApplySettings, on the thread owning ProjContext.
+	void BuildSourceWorkerContext();
+
+	// Clone of SourceWorkerContext. Must be called with WorkerContextsMutex locked.
+	TUniquePtr<FProjWorkerContext> CreateWorkerContext();
+
+	FProjPipelines GetPipelines() const
+	{
+		WaitForInitialization();
+		return { ProjProjectedToGeographic, ProjProjectedToECEF, ProjGeographicToECEF };
+	}
+
+	// Native conversions
+	bool ValidateNativeGeographicToECEF(double ToleranceMeters);
+	bool ConfigureNativeTransverseMercator(const FString& ProjectedCRS, double ToleranceMeters);
+
+	// CRS pairs registry. Must be called with CRSPairTransformsMutex locked, which must stay locked while the pipeline is used.
+	// A capacity change keeps the most recently used pipelines that still fit.
+	TSharedPtr<FCRSPairTransform> FindOrAddCRSPairTransform(const FString& SourceCRS, const FString& TargetCRS, int32 Capacity);
+	// Accuracy of a registry pipeline, queried on CRSPairContext
+	FTransformationAccuracy ComputeTransformationAccuracy(PJ* Pipeline) const;
+
+	// Asynchronous batches in flight. Settings changes and destruction cancel them and wait for their completion.
+	void RegisterAsyncBatch(const TSharedRef<FGeoBatchTaskHandle>& Task);
+	void UnregisterAsyncBatch(const TSharedRef<FGeoBatchTaskHandle>& Task);
+	void CancelAsyncBatches();
+	void WaitForAsyncBatches();
+	float GetAsyncBatchesProgress();
+
 	PJ_CONTEXT* ProjContext;
 	PJ* ProjProjectedToGeographic;
 	PJ* ProjProjectedToECEF;
 	PJ* ProjGeographicToECEF;
+	PJ* ProjProjectedCRS; // The projected CRS itself, for proj_factors. Null if it is not a projection.
 	FEllipsoid ProjectedEllipsoid;
 	FEllipsoid GeographicEllipsoid;
 
+	// True when GeographicEllipsoid closed-form formulas replace ProjGeographicToECEF
+	bool bNativeGeographicToECEF = false;
+
+	// True when TransverseMercator replaces ProjProjectedToGeographic
+	bool bNativeTransverseMercator = false;
+	FTransverseMercator TransverseMercator;
+
+	FString ProjDataPath;
+
+	// Idle worker contexts, at most one per task graph thread plus the calling one, and the pipelines generation they must match to be reused. Bumped by ApplySettings.
+	// SourceWorkerContext is the copy of the main pipelines the worker contexts are cloned from. It is only used with WorkerContextsMutex locked.
+	TArray<TUniquePtr<FProjWorkerContext>> FreeWorkerContexts;
+	TUniquePtr<FProjWorkerContext> SourceWorkerContext;
+	uint32 PipelinesGeneration = 0;
+	FCriticalSection WorkerContextsMutex;
+
+	// Pipelines built for arbitrary CRS pairs (accuracy queries, TransformCoordinates), least recently used destroyed first.
+	// They live on their own PROJ context : ProjContext is used by the single point conversions without this lock. Both are only used with CRSPairTransformsMutex locked.
+	TLruCache<TPair<FString, FString>, TSharedPtr<FCRSPairTransform>> CRSPairTransforms;
+	PJ_CONTEXT* CRSPairContext = nullptr;
+	FCriticalSection CRSPairTransformsMutex;
+
+	TArray<TSharedRef<FGeoBatchTaskHandle>> AsyncBatches;
+	FCriticalSection AsyncBatchesMutex;
+	FEventRef NoAsyncBatchesEvent { EEventMode::ManualReset }; // Triggered while AsyncBatches is empty
+
+	// Last approximation built for the approximate batches, reused while the data stays in its bounds
+	TSharedPtr<FGeoApproximateTransformer> ApproximateTransformer;
+	EGeoConversion ApproximateConversion = EGeoConversion::Count;
+	FCriticalSection ApproximateTransformerMutex;
+
+	// Batch calls latency, one histogram per conversion, plus one for TransformCoordinates (EGeoConversion::Count)
+	FGeoLatencyHistogram LatencyHistograms[static_cast<int32>(EGeoConversion::Count) + 1];
+
+	// Tangent frame batches latency, apart from the conversions
+	FGeoLatencyHistogram TangentFramesLatencyHistogram;
+
+	// Memoized GeographicToEngine / EngineToGeographic results, used when bUseCoordinateCache is set
+	FGeoCoordinateCache CoordinateCache;
+	int32 CoordinateCacheSizeApplied = 0;
+
+	// Projection factors per grid cell, used by GetProjectionFactors and the FlatPlanet ENU vectors when bUseProjectionFactorsCache is set
+	FGeoProjectionFactorsCache ProjectionFactorsCache;
+
 	// Transformation caches 
 	// Flat Planet
 	FVector WorldOriginLocationProjected; // Offset between the UE world and the Projected CRS Origin. (Expressed in ProjectedCRS units).
@@ -139,6 +604,56 @@ public:
 
 	FMatrix WorldFrameToUEFrame;
 	FMatrix UEFrameToWorldFrame;
+
+	// Engine frame transforms with the UE units conversion and the Y flip fused in, for the batch kernels
+	FGeoAffineTransform EngineToECEFTransform; // Round Planet
+	FGeoAffineTransform ECEFToEngineTransform; // Round Planet
+	FGeoAffineTransform EngineToProjectedTransform; // Flat Planet
+	FGeoAffineTransform ProjectedToEngineTransform; // Flat Planet
+
+	// Local frames grid : tangent frame to ECEF matrix of each cell, indexed Row * LocalFrameGridColumns + Column, row 0 at the minimum latitude.
+	// The grid settings are copied when it is built, since the properties can be edited without applying them.
+	TArray<FMatrix> LocalFrameCells;
+	int32 LocalFrameGridColumns = 0;
+	int32 LocalFrameGridRows = 0;
+	double LocalFrameGridMinLongitude = 0.0;
+	double LocalFrameGridMinLatitude = 0.0;
+	double LocalFrameGridCellSize = 1.0;
+
+	// Settings the grid was built with, unset if there is none
+	struct FLocalFrameGridSettings
+	{
+		double CellSize = 0.0;
+		double MinLongitude = 0.0;
+		double MaxLongitude = 0.0;
+		double MinLatitude = 0.0;
+		double MaxLatitude = 0.0;
+		FString GeographicCRS;
+
+		bool operator==(const FLocalFrameGridSettings& Other) const
+		{
+			return CellSize == Other.CellSize && MinLongitude == Other.MinLongitude && MaxLongitude == Other.MaxLongitude
+				&& MinLatitude == Other.MinLatitude && MaxLatitude == Other.MaxLatitude && GeographicCRS == Other.GeographicCRS;
+		}
+	};
+	TOptional<FLocalFrameGridSettings> LocalFrameGridSettings;
+
+	// Batch kernels for the current settings, indexed by EGeoConversion, and the constants they read. Set by SelectStreamKernels.
+	FGeoStreamKernel StreamKernels[static_cast<int32>(EGeoConversion::Count)] = {};
+	FGeoStreamKernelConstants StreamKernelConstants;
+
+	// Asynchronous initialization : PROJ setup and first ApplySettings on a background task, see AGeoReferencingSystem::Initialize
+	TFuture<void> InitializationFuture;
+	std::atomic<bool> bInitialized { false };
+	std::atomic<uint32> InitializingThreadId { 0 };
+
+	// Last snapshot published by ApplySettings. The lock only covers copying the shared pointer, never a conversion.
+	// Replaced snapshots are owned by the handles still given out, and destroyed with their PROJ contexts when the last one is released.
+	TSharedPtr<FGeoTransformerSnapshot, ESPMode::ThreadSafe> CurrentSnapshot;
+	mutable FRWLock CurrentSnapshotLock;
+
+	// Serial of CurrentSnapshot, readable without the lock
+	std::atomic<uint32> CurrentSnapshotSerial { 0 };
 };
 
 /////// INIT / DEINIT
@@ -164,11 +679,20 @@ void AGeoReferencingSystem::Initialize()
 		UE_LOG(LogGeoReferencing, Display, TEXT("Enable World Bounds Checks is enabled in your World Settings. You might consider disabling it when working with large terrains, otherwise your pawns won't be able to go too far from the Origin"));
 	}
 
+	// Initialized again (loaded after being created, re-instanced...) : the previous initialization task and batches use the internals being replaced
+	if (Impl)
+	{
+		if (Impl->InitializationFuture.IsValid())
+		{
+			Impl->InitializationFuture.Wait();
+		}
+		Impl->CancelAsyncBatches();
+		Impl->WaitForAsyncBatches();
+		Impl->DeInitPROJLibrary();
+	}
 
 	Impl = MakePimpl<FGeoReferencingSystemInternals>();
 
-	Impl->InitPROJLibrary();
-
 	// Should we consider other conventions ? Or North Offset like in SunPosition?
 	Impl->WorldFrameToUEFrame = FMatrix( 
 		FVector(1.0, 0.0, 0.0),		// Easting (X) is UE World X
@@ -179,7 +703,69 @@ void AGeoReferencingSystem::Initialize()
 
 	Impl->UEFrameToWorldFrame = Impl->WorldFrameToUEFrame.Inverse();
 
-	ApplySettings();
+	// Setting PROJ up and building the pipelines takes from tens to hundreds of milliseconds (plus a copy of the PROJ data in sandboxed runs).
+	// Do it on a background task : the level keeps loading, and the functions called meanwhile wait for its completion.
+	// The task applies the settings of this moment, the properties can be edited meanwhile.
+	const FAppliedSettings Settings = CaptureSettings();
+	if (bInitializeAsynchronously && FPlatformProcess::SupportsMultithreading() && !IsRunningCommandlet())
+	{
+		TWeakObjectPtr<AGeoReferencingSystem> WeakThis(this);
+		const FGeoReferencingSystemInternals* Internals = Impl.Get();
+		Impl->InitializationFuture = Async(EAsyncExecution::ThreadPool, [this, WeakThis, Internals, Settings]()
+		{
+			Impl->InitializingThreadId.store(FPlatformTLS::GetCurrentThreadId(), std::memory_order_relaxed);
+			Impl->InitPROJLibrary();
+			const bool bSuccess = ApplySettingsInternal(Settings);
+			Impl->InitializingThreadId.store(0, std::memory_order_relaxed);
+			Impl->bInitialized.store(true, std::memory_order_release);
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Internals, bSuccess]()
+			{
+				// Not if the system was initialized again meanwhile, its new initialization notifies its own result
+				AGeoReferencingSystem* GeoReferencingSystem = WeakThis.Get();
+				if (GeoReferencingSystem != nullptr && GeoReferencingSystem->Impl.Get() == Internals)
+				{
+					GeoReferencingSystem->OnInitialized(bSuccess);
+				}
+			});
+		});
+	}
+	else
+	{
+		Impl->InitPROJLibrary();
+		const bool bSuccess = ApplySettingsInternal(Settings);
+		Impl->bInitialized.store(true, std::memory_order_release);
+		OnInitialized(bSuccess);
+	}
+}
+
+void AGeoReferencingSystem::OnInitialized(bool bSuccess)
+{
+#if WITH_EDITOR
+	if (!bSuccess)
+	{
+		NotifyCRSError();
+	}
+#endif
+
+	OnReady.Broadcast(bSuccess);
+}
+
+bool AGeoReferencingSystem::IsReady() const
+{
+	return Impl && Impl->bInitialized.load(std::memory_order_acquire);
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::WaitForInitialization() const
+{
+	if (bInitialized.load(std::memory_order_acquire) || !InitializationFuture.IsValid() || InitializingThreadId.load(std::memory_order_relaxed) == FPlatformTLS::GetCurrentThreadId())
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	InitializationFuture.Wait();
+	UE_LOG(LogGeoReferencing, Verbose, TEXT("Waited %.2f ms for the GeoReferencing initialization"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
 void AGeoReferencingSystem::BeginDestroy()
@@ -188,12 +774,20 @@ void AGeoReferencingSystem::BeginDestroy()
 
 	if (Impl)
 	{
+		// The initialization task and running batches use this system : stop them before releasing anything
+		Impl->WaitForInitialization();
+		Impl->CancelAsyncBatches();
+		Impl->WaitForAsyncBatches();
+
 		Impl->DeInitPROJLibrary();
 	}
 }
 
 void AGeoReferencingSystem::EngineToProjected(const FVector& EngineCoordinates, FVector& ProjectedCoordinates)
 {
+	GEOREFERENCING_SCOPE(EngineToProjected);
+	Impl->WaitForInitialization();
+
 	switch (PlanetShape)
 	{
 	case EPlanetShape::RoundPlanet:
@@ -208,12 +802,9 @@ void AGeoReferencingSystem::EngineToProjected(const FVector& EngineCoordinates,
 	case EPlanetShape::FlatPlanet:
 	default:
 	{
-		// in FlatPlanet, the transform is simply a translation
-		// Convert UE units to meters, invert the Y coordinate because of left-handed UE Frame
-		FVector UEWorldCoordinates = EngineCoordinates * FVector(0.01, -0.01, 0.01);
-
-		// Add the defined origin offset
-		ProjectedCoordinates = UEWorldCoordinates + Impl->WorldOriginLocationProjected;
+		// in FlatPlanet, the transform is simply a translation, after converting UE units to meters and inverting the Y coordinate because of left-handed UE Frame
+		// Same fused transform as the batch conversions, so that both give identical results
+		ProjectedCoordinates = Impl->EngineToProjectedTransform.TransformPosition(EngineCoordinates);
 	}
 	break;
 	}
@@ -221,6 +812,9 @@ void AGeoReferencingSystem::EngineToProjected(const FVector& EngineCoordinates,
 
 void AGeoReferencingSystem::ProjectedToEngine(const FVector& ProjectedCoordinates, FVector& EngineCoordinates)
 {
+	GEOREFERENCING_SCOPE(ProjectedToEngine);
+	Impl->WaitForInitialization();
+
 	switch (PlanetShape)
 	{
 	case EPlanetShape::RoundPlanet:
@@ -235,12 +829,9 @@ void AGeoReferencingSystem::ProjectedToEngine(const FVector& ProjectedCoordinate
 	case EPlanetShape::FlatPlanet:
 	default:
 	{
-		// in FlatPlanet, the transform is simply a translation
-		// Remove the Origin location, and convert to UE Units, while inverting the Z Axis
-		FVector UEWorldCoordinates = (ProjectedCoordinates - Impl->WorldOriginLocationProjected);
-
-		// Convert UE units to meters, invert the Y coordinate because of left-handed UE Frame
-		EngineCoordinates = UEWorldCoordinates * FVector(100.0, -100.0, 100.0);
+		// in FlatPlanet, the transform is simply a translation, followed by the conversion to UE units and the Y inversion because of left-handed UE Frame
+		// Same fused transform as the batch conversions, so that both give identical results
+		EngineCoordinates = Impl->ProjectedToEngineTransform.TransformPosition(ProjectedCoordinates);
 	}
 	break;
 	}
@@ -248,22 +839,16 @@ void AGeoReferencingSystem::ProjectedToEngine(const FVector& ProjectedCoordinate
 
 void AGeoReferencingSystem::EngineToECEF(const FVector& EngineCoordinates, FVector& ECEFCoordinates)
 {
+	GEOREFERENCING_SCOPE(EngineToECEF);
+	Impl->WaitForInitialization();
+
 	switch (PlanetShape)
 	{
 	case EPlanetShape::RoundPlanet:
 	{
-		// Convert UE units to meters, invert the Y coordinate because of left-handed UE Frame
-		FVector UEWorldCoordinates = EngineCoordinates * FVector(0.01, -0.01, 0.01);
-
-		if (bOriginAtPlanetCenter)
-		{
-			// Easy case, UE is ECEF... return the Global coordinates
-			ECEFCoordinates = UEWorldCoordinates; // TOCHECK Types
-		}
-		else
-		{
-			ECEFCoordinates = Impl->WorldFrameToECEFFrame.TransformPosition(UEWorldCoordinates);
-		}
+		// Convert UE units to meters, invert the Y coordinate because of left-handed UE Frame, then move to the ECEF frame (identity when the origin is at the planet center)
+		// Same fused transform as the batch conversions, so that both give identical results
+		ECEFCoordinates = Impl->EngineToECEFTransform.TransformPosition(EngineCoordinates);
 	}
 	break;
 
@@ -281,23 +866,16 @@ void AGeoReferencingSystem::EngineToECEF(const FVector& EngineCoordinates, FVect
 
 void AGeoReferencingSystem::ECEFToEngine(const FVector& ECEFCoordinates, FVector& EngineCoordinates)
 {
+	GEOREFERENCING_SCOPE(ECEFToEngine);
+	Impl->WaitForInitialization();
+
 	switch (PlanetShape)
 	{
 	case EPlanetShape::RoundPlanet:
 	{
-		FVector UEWorldCoordinates;
-		if (bOriginAtPlanetCenter)
-		{
-			// Easy case, UE is ECEF... And we did the rebasing, so return the Global coordinates
-			UEWorldCoordinates = ECEFCoordinates;
-		}
-		else
-		{
-			UEWorldCoordinates = Impl->ECEFFrameToWorldFrame.TransformPosition(ECEFCoordinates);
-		}
-
-		// Convert UE units to meters, invert the Y coordinate because of left-handed UE Frame
-		EngineCoordinates = UEWorldCoordinates * FVector(100.0, -100.0, 100.0);
+		// Move to the world frame (identity when the origin is at the planet center), then convert meters to UE units and invert the Y coordinate because of left-handed UE Frame
+		// Same fused transform as the batch conversions, so that both give identical results
+		EngineCoordinates = Impl->ECEFToEngineTransform.TransformPosition(ECEFCoordinates);
 	}
 	break;
 
@@ -316,6 +894,17 @@ void AGeoReferencingSystem::ECEFToEngine(const FVector& ECEFCoordinates, FVector
 
 void AGeoReferencingSystem::EngineToGeographic(const FVector& EngineCoordinates, FGeographicCoordinates& GeographicCoordinates)
 {
+	GEOREFERENCING_SCOPE(EngineToGeographic);
+	Impl->WaitForInitialization();
+
+	FVector CachedCoordinates;
+	uint32 CacheGeneration = 0;
+	if (bUseCoordinateCache && Impl->CoordinateCache.Find(EGeoConversion::EngineToGeographic, EngineCoordinates, CachedCoordinates, CacheGeneration))
+	{
+		GeographicCoordinates = FGeographicCoordinates(CachedCoordinates.X, CachedCoordinates.Y, CachedCoordinates.Z);
+		return;
+	}
+
 	switch (PlanetShape)
 	{
 		case EPlanetShape::RoundPlanet:
@@ -336,14 +925,29 @@ void AGeoReferencingSystem::EngineToGeographic(const FVector& EngineCoordinates,
 		}
 	break;
 	}
+
+	if (bUseCoordinateCache)
+	{
+		Impl->CoordinateCache.Add(EGeoConversion::EngineToGeographic, EngineCoordinates, FVector(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude, GeographicCoordinates.Altitude), CacheGeneration);
+	}
 }
 
 void AGeoReferencingSystem::GeographicToEngine(const FGeographicCoordinates& GeographicCoordinates, FVector& EngineCoordinates)
 {
-	switch (PlanetShape)
+	GEOREFERENCING_SCOPE(GeographicToEngine);
+	Impl->WaitForInitialization();
+
+	const FVector GeographicKey(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude, GeographicCoordinates.Altitude);
+	uint32 CacheGeneration = 0;
+	if (bUseCoordinateCache && Impl->CoordinateCache.Find(EGeoConversion::GeographicToEngine, GeographicKey, EngineCoordinates, CacheGeneration))
 	{
-		case EPlanetShape::RoundPlanet:
-		{
+		return;
+	}
+
+	switch (PlanetShape)
+	{
+		case EPlanetShape::RoundPlanet:
+		{
 			FVector ECEFCoordinates;
 			GeographicToECEF(GeographicCoordinates, ECEFCoordinates);
 			ECEFToEngine(ECEFCoordinates, EngineCoordinates);
@@ -359,6 +963,11 @@ void AGeoReferencingSystem::GeographicToEngine(const FGeographicCoordinates& Geo
 		}
 	break;
 	}
+
+	if (bUseCoordinateCache)
+	{
+		Impl->CoordinateCache.Add(EGeoConversion::GeographicToEngine, GeographicKey, EngineCoordinates, CacheGeneration);
+	}
 }
 
 bool AGeoReferencingSystem::GeographicToEngineWithAccuracy(
@@ -427,7 +1036,11 @@ bool AGeoReferencingSystem::TryGeographicToEngine(
 		return false;
 	}
 
-	// Check for PROJ context
+	// Check for PROJ context, once the asynchronous initialization (if any) has set it
+	if (Impl)
+	{
+		Impl->WaitForInitialization();
+	}
 	if (!Impl || !Impl->ProjContext)
 	{
 		if (OutError)
@@ -470,56 +1083,94 @@ FTransformationAccuracy AGeoReferencingSystem::GetTransformationAccuracy(
 {
 	FTransformationAccuracy Accuracy;
 
+	if (Impl)
+	{
+		Impl->WaitForInitialization();
+	}
 	if (!Impl || !Impl->ProjContext)
 	{
 		Accuracy.TransformationMethod = TEXT("Error: PROJ context not initialized");
 		return Accuracy;
 	}
 
-	// Get PROJ transformation object
-	PJ* Projection = Impl->GetPROJProjection(SourceCRS, TargetCRS);
-	if (!Projection)
+	// Pipelines and their accuracy are cached per CRS pair
+	FScopeLock Lock(&Impl->CRSPairTransformsMutex);
+	TSharedPtr<FCRSPairTransform> Transform = Impl->FindOrAddCRSPairTransform(SourceCRS, TargetCRS, TransformationRegistryCapacity);
+	if (!Transform.IsValid())
 	{
 		Accuracy.TransformationMethod = TEXT("Error: Could not create transformation");
 		return Accuracy;
 	}
-	double HorizAccuracy = -1.0;
-	double VertAccuracy = -1.0;
-	// Query accuracy from PROJ (requires PROJ 6.0+)
-	// Note: proj_trans_get_accuracy returns -1 if accuracy is unknown
-#if defined(PROJ_VERSION_MAJOR) && PROJ_VERSION_MAJOR >= 9
-	HorizAccuracy = VertAccuracy= proj_coordoperation_get_accuracy(Impl->ProjContext, Projection);
-#else
-	// proj_trans_get_accuracy not available in this PROJ version — leave as -1 (unknown)
-	UE_LOG(LogGeoReferencing, Verbose, TEXT("proj_trans_get_accuracy not available in this PROJ build; returning unknown accuracy"));
 
-#endif
-	Accuracy.HorizontalAccuracyMeters = HorizAccuracy;
-	Accuracy.VerticalAccuracyMeters = VertAccuracy;
+	return Transform->Accuracy;
+}
 
-	// Get information about the transformation
-	PJ_PROJ_INFO info = proj_pj_info(Projection);
-	if (info.definition)
+bool AGeoReferencingSystem::TransformCoordinates(
+	const FString& SourceCRS,
+	const FString& TargetCRS,
+	const TArray<FVector>& SourceCoordinates,
+	TArray<FVector>& TargetCoordinates)
+{
+	TargetCoordinates = SourceCoordinates;
+	if (!TransformCoordinates(SourceCRS, TargetCRS, FGeoCoordinateStreams::Make(MakeArrayView(TargetCoordinates))))
 	{
-		Accuracy.TransformationMethod = FString(UTF8_TO_TCHAR(info.definition));
+		TargetCoordinates.Reset();
+		return false;
 	}
+	return true;
+}
 
-	// Check if transformation uses grid files
-	Accuracy.bIsGridBased = Accuracy.TransformationMethod.Contains(TEXT("grid")) || 
-	                        Accuracy.TransformationMethod.Contains(TEXT("nadgrid"));
+bool AGeoReferencingSystem::TransformCoordinates(
+	const FString& SourceCRS,
+	const FString& TargetCRS,
+	const FGeoCoordinateStreams& Coordinates)
+{
+	GEOREFERENCING_SCOPE(BatchTransform);
+
+	if (Impl)
+	{
+		Impl->WaitForInitialization();
+	}
+	if (!Impl || !Impl->ProjContext)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("TransformCoordinates: PROJ context not initialized"));
+		return false;
+	}
 
-	proj_destroy(Projection);
+	// Track performance
+	double StartTime = FPlatformTime::Seconds();
 
-	return Accuracy;
+	{
+		// The pipeline is bound to the registry context, keep the registry locked while it runs
+		FScopeLock Lock(&Impl->CRSPairTransformsMutex);
+		TSharedPtr<FCRSPairTransform> Transform = Impl->FindOrAddCRSPairTransform(SourceCRS, TargetCRS, TransformationRegistryCapacity);
+		if (!Transform.IsValid())
+		{
+			return false;
+		}
+
+		const size_t Count = static_cast<size_t>(Coordinates.Num);
+		if (Count > 0)
+		{
+			proj_trans_generic(Transform->Pipeline, PJ_FWD, Coordinates.X, Coordinates.Stride, Count, Coordinates.Y, Coordinates.Stride, Count, Coordinates.Z, Coordinates.Stride, Count, nullptr, 0, 0);
+		}
+	}
+
+	// Update performance stats
+	RecordBatchStats(EGeoConversion::Count, Coordinates.Num, (FPlatformTime::Seconds() - StartTime) * 1000000.0);
+	return true;
 }
 
 // Batch Transformations
 
+// Number of points sent to PROJ in a single proj_trans_generic call. Small enough for the copy, PROJ and matrix passes to stay in cache.
+static constexpr int32 GeoReferencingBatchChunkSize = 4096;
+
 void AGeoReferencingSystem::GeographicToEngineBatch(
 	const TArray<FGeographicCoordinates>& GeographicCoordinates,
 	TArray<FVector>& EngineCoordinates)
 {
-	SCOPE_CYCLE_COUNTER(STAT_GeoReferencingBatchTransform);
+	GEOREFERENCING_SCOPE(BatchTransform);
 	
 	// Pre-allocate output array for efficiency
 	EngineCoordinates.SetNum(GeographicCoordinates.Num());
@@ -527,41 +1178,34 @@ void AGeoReferencingSystem::GeographicToEngineBatch(
 	// Track performance
 	double StartTime = FPlatformTime::Seconds();
 
-	// Transform each coordinate
-	for (int32 i = 0; i < GeographicCoordinates.Num(); ++i)
+	// Transform the coordinates chunk by chunk
+	const FProjPipelines Pipelines = Impl->GetPipelines();
+	if (ShouldApproximateBatch(GeographicCoordinates.Num()))
 	{
-		GeographicToEngine(GeographicCoordinates[i], EngineCoordinates[i]);
-	}
-
-	// Update performance stats
-	double ElapsedMicroseconds = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
-	{
-		FScopeLock Lock(&StatsMutex);
-		PerformanceStats.TotalTransformations += GeographicCoordinates.Num();
-		
-		// Update average time
-		if (PerformanceStats.TotalTransformations > 0)
+		for (int32 i = 0; i < GeographicCoordinates.Num(); ++i)
 		{
-			double TotalTime = PerformanceStats.AverageTransformTimeMicroseconds * 
-			                   (PerformanceStats.TotalTransformations - GeographicCoordinates.Num());
-			TotalTime += ElapsedMicroseconds;
-			PerformanceStats.AverageTransformTimeMicroseconds = TotalTime / PerformanceStats.TotalTransformations;
+			EngineCoordinates[i] = FVector(GeographicCoordinates[i].Longitude, GeographicCoordinates[i].Latitude, GeographicCoordinates[i].Altitude);
 		}
-
-		// Update max time (per transformation)
-		double PerTransformTime = ElapsedMicroseconds / FMath::Max(1, GeographicCoordinates.Num());
-		if (PerTransformTime > PerformanceStats.MaxTransformTimeMicroseconds)
+		TransformStreamsApproximate(EGeoConversion::GeographicToEngine, Pipelines, FGeoCoordinateStreams::Make(MakeArrayView(EngineCoordinates)));
+	}
+	else
+	{
+		for (int32 StartIndex = 0; StartIndex < GeographicCoordinates.Num(); StartIndex += GeoReferencingBatchChunkSize)
 		{
-			PerformanceStats.MaxTransformTimeMicroseconds = PerTransformTime;
+			const int32 Num = FMath::Min(GeoReferencingBatchChunkSize, GeographicCoordinates.Num() - StartIndex);
+			GeographicToEngineRange(Pipelines, GeographicCoordinates.GetData() + StartIndex, EngineCoordinates.GetData() + StartIndex, Num);
 		}
 	}
+
+	// Update performance stats
+	RecordBatchStats(EGeoConversion::GeographicToEngine, GeographicCoordinates.Num(), (FPlatformTime::Seconds() - StartTime) * 1000000.0);
 }
 
 void AGeoReferencingSystem::EngineToGeographicBatch(
 	const TArray<FVector>& EngineCoordinates,
 	TArray<FGeographicCoordinates>& GeographicCoordinates)
 {
-	SCOPE_CYCLE_COUNTER(STAT_GeoReferencingBatchTransform);
+	GEOREFERENCING_SCOPE(BatchTransform);
 	
 	// Pre-allocate output array for efficiency
 	GeographicCoordinates.SetNum(EngineCoordinates.Num());
@@ -569,34 +1213,27 @@ void AGeoReferencingSystem::EngineToGeographicBatch(
 	// Track performance
 	double StartTime = FPlatformTime::Seconds();
 
-	// Transform each coordinate
-	for (int32 i = 0; i < EngineCoordinates.Num(); ++i)
-	{
-		EngineToGeographic(EngineCoordinates[i], GeographicCoordinates[i]);
-	}
-
-	// Update performance stats
-	double ElapsedMicroseconds = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+	// Transform the coordinates chunk by chunk
+	const FProjPipelines Pipelines = Impl->GetPipelines();
+	if (ShouldApproximateBatch(EngineCoordinates.Num()))
 	{
-		FScopeLock Lock(&StatsMutex);
-		PerformanceStats.TotalTransformations += EngineCoordinates.Num();
-		
-		// Update average time
-		if (PerformanceStats.TotalTransformations > 0)
+		for (int32 i = 0; i < EngineCoordinates.Num(); ++i)
 		{
-			double TotalTime = PerformanceStats.AverageTransformTimeMicroseconds * 
-			                   (PerformanceStats.TotalTransformations - EngineCoordinates.Num());
-			TotalTime += ElapsedMicroseconds;
-			PerformanceStats.AverageTransformTimeMicroseconds = TotalTime / PerformanceStats.TotalTransformations;
+			GeographicCoordinates[i] = FGeographicCoordinates(EngineCoordinates[i].X, EngineCoordinates[i].Y, EngineCoordinates[i].Z);
 		}
-
-		// Update max time (per transformation)
-		double PerTransformTime = ElapsedMicroseconds / FMath::Max(1, EngineCoordinates.Num());
-		if (PerTransformTime > PerformanceStats.MaxTransformTimeMicroseconds)
+		TransformStreamsApproximate(EGeoConversion::EngineToGeographic, Pipelines, FGeoCoordinateStreams::Make(MakeArrayView(GeographicCoordinates)));
+	}
+	else
+	{
+		for (int32 StartIndex = 0; StartIndex < EngineCoordinates.Num(); StartIndex += GeoReferencingBatchChunkSize)
 		{
-			PerformanceStats.MaxTransformTimeMicroseconds = PerTransformTime;
+			const int32 Num = FMath::Min(GeoReferencingBatchChunkSize, EngineCoordinates.Num() - StartIndex);
+			EngineToGeographicRange(Pipelines, EngineCoordinates.GetData() + StartIndex, GeographicCoordinates.GetData() + StartIndex, Num);
 		}
 	}
+
+	// Update performance stats
+	RecordBatchStats(EGeoConversion::EngineToGeographic, EngineCoordinates.Num(), (FPlatformTime::Seconds() - StartTime) * 1000000.0);
 }
 
 void AGeoReferencingSystem::GeographicToEngineBatchParallel(
@@ -615,6 +1252,9 @@ void AGeoReferencingSystem::GeographicToEngineBatchParallel(
 	// Track performance
 	double StartTime = FPlatformTime::Seconds();
 
+	// One chunk per thread able to run it : more would only add PROJ contexts waiting for a worker
+	NumThreads = FMath::Min(NumThreads, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+
 	// For small batches, use single-threaded version
 	if (Geographic.Num() < 100 || NumThreads <= 1)
 	{
@@ -623,714 +1263,2907 @@ void AGeoReferencingSystem::GeographicToEngineBatchParallel(
 	}
 
 	// Calculate chunk size for each thread
-	const int32 ChunkSize = FMath::CeilToInt(static_cast<float>(Geographic.Num()) / NumThreads);
+	const int32 ChunkSize = FMath::DivideAndRoundUp(Geographic.Num(), NumThreads);
+	const int32 NumChunks = FMath::DivideAndRoundUp(Geographic.Num(), ChunkSize);
+
+	// PROJ objects can't be shared between threads : lease one context with its own pipelines per chunk
+	TArray<TUniquePtr<FProjWorkerContext>> WorkerContexts;
+	if (!Impl->AcquireWorkerContexts(NumChunks, WorkerContexts))
+	{
+		UE_LOG(LogGeoReferencing, Warning, TEXT("GeographicToEngineBatchParallel could not create the PROJ worker contexts, falling back to single-threaded batch"));
+		GeographicToEngineBatch(Geographic, Engine);
+		return;
+	}
 
-	// Use ParallelFor for thread-safe parallel execution
-	ParallelFor(NumThreads, [&](int32 ThreadIndex)
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
 	{
-		const int32 StartIndex = ThreadIndex * ChunkSize;
-		const int32 EndIndex = FMath::Min(StartIndex + ChunkSize, Geographic.Num());
+		const FProjPipelines& Pipelines = WorkerContexts[ChunkIndex]->Pipelines;
+		const int32 EndIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, Geographic.Num());
 
-		for (int32 i = StartIndex; i < EndIndex; ++i)
+		for (int32 StartIndex = ChunkIndex * ChunkSize; StartIndex < EndIndex; StartIndex += GeoReferencingBatchChunkSize)
 		{
-			GeographicToEngine(Geographic[i], Engine[i]);
+			const int32 Num = FMath::Min(GeoReferencingBatchChunkSize, EndIndex - StartIndex);
+			GeographicToEngineRange(Pipelines, Geographic.GetData() + StartIndex, Engine.GetData() + StartIndex, Num);
 		}
 	});
 
+	Impl->ReleaseWorkerContexts(WorkerContexts);
+
 	// Update performance stats
-	double ElapsedMicroseconds = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+	RecordBatchStats(EGeoConversion::GeographicToEngine, Geographic.Num(), (FPlatformTime::Seconds() - StartTime) * 1000000.0);
+}
+
+void AGeoReferencingSystem::GeographicToEngineRange(const FProjPipelines& Pipelines, const FGeographicCoordinates* Geographic, FVector* Engine, int32 Num)
+{
+	// The conversion runs in place : the input is copied in the output array, then transformed through strides pointing into it
+	for (int32 i = 0; i < Num; ++i)
 	{
-		FScopeLock Lock(&StatsMutex);
-		PerformanceStats.TotalTransformations += Geographic.Num();
-		
-		// Update average time
-		if (PerformanceStats.TotalTransformations > 0)
-		{
-			double TotalTime = PerformanceStats.AverageTransformTimeMicroseconds * 
-			                   (PerformanceStats.TotalTransformations - Geographic.Num());
-			TotalTime += ElapsedMicroseconds;
-			PerformanceStats.AverageTransformTimeMicroseconds = TotalTime / PerformanceStats.TotalTransformations;
-		}
+		Engine[i] = FVector(Geographic[i].Longitude, Geographic[i].Latitude, Geographic[i].Altitude);
+	}
+	TransformStreams(EGeoConversion::GeographicToEngine, Pipelines, FGeoCoordinateStreams::Make(MakeArrayView(Engine, Num)));
+}
 
-		// Update max time (per transformation)
-		double PerTransformTime = ElapsedMicroseconds / FMath::Max(1, Geographic.Num());
-		if (PerTransformTime > PerformanceStats.MaxTransformTimeMicroseconds)
-		{
-			PerformanceStats.MaxTransformTimeMicroseconds = PerTransformTime;
-		}
+void AGeoReferencingSystem::EngineToGeographicRange(const FProjPipelines& Pipelines, const FVector* Engine, FGeographicCoordinates* Geographic, int32 Num)
+{
+	// Intermediate coordinates are written in the output array (Longitude = X, Latitude = Y, Altitude = Z)
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Geographic[i].Longitude = Engine[i].X;
+		Geographic[i].Latitude = Engine[i].Y;
+		Geographic[i].Altitude = Engine[i].Z;
 	}
+	TransformStreams(EGeoConversion::EngineToGeographic, Pipelines, FGeoCoordinateStreams::Make(MakeArrayView(Geographic, Num)));
 }
 
-// Performance Monitoring
+void AGeoReferencingSystem::TransformStreams(EGeoConversion Conversion, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
+{
+	// The kernel for the current settings is picked once for the batch.
+	// Multi-stage conversions run stage after stage on each chunk, while it is still in cache
+	const FGeoStreamKernel Kernel = Impl->StreamKernels[static_cast<int32>(Conversion)];
+	if (Kernel == nullptr)
+	{
+		return;
+	}
 
-FGeoReferencingStats AGeoReferencingSystem::GetPerformanceStats() const
+	const FGeoStreamKernelConstants& Constants = Impl->StreamKernelConstants;
+	for (int32 StartIndex = 0; StartIndex < Streams.Num; StartIndex += GeoReferencingBatchChunkSize)
+	{
+		const int32 Num = FMath::Min(GeoReferencingBatchChunkSize, Streams.Num - StartIndex);
+		Kernel(Constants, Pipelines, Streams.Slice(StartIndex, Num));
+	}
+}
+
+bool AGeoReferencingSystem::ShouldApproximateBatch(int32 NumCoordinates) const
 {
-	FScopeLock Lock(&StatsMutex);
-	return PerformanceStats;
+	return bUseApproximateBatches && NumCoordinates >= ApproximateBatchesMinPoints;
 }
 
-void AGeoReferencingSystem::ResetPerformanceStats()
+void AGeoReferencingSystem::TransformStreamsBatch(EGeoConversion Conversion, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
 {
-	FScopeLock Lock(&StatsMutex);
-	PerformanceStats = FGeoReferencingStats();
+	if (ShouldApproximateBatch(Streams.Num))
+	{
+		TransformStreamsApproximate(Conversion, Pipelines, Streams);
+	}
+	else
+	{
+		TransformStreams(Conversion, Pipelines, Streams);
+	}
 }
 
-// Coordinate Precision Calculator
+// Maximum subdivision level of the approximate batches quadtree. Cells along discontinuities (antimeridian, poles) stop there and are converted exactly.
+static constexpr int32 GeoReferencingApproximationMaxDepth = 8;
 
-FCoordinatePrecision AGeoReferencingSystem::GetPrecisionAtLocation(const FVector& EngineCoordinates)
+void AGeoReferencingSystem::TransformStreamsApproximate(EGeoConversion Conversion, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams)
 {
-	FCoordinatePrecision Precision;
+	const double StartTime = FPlatformTime::Seconds();
 
-	// Calculate distance from origin in centimeters
-	double DistanceCm = EngineCoordinates.Size();
-	Precision.DistanceFromOriginKm = DistanceCm / 100000.0; // Convert cm to km
+	auto ExactTransform = [this, Conversion, &Pipelines](const FGeoCoordinateStreams& ExactStreams)
+	{
+		TransformStreams(Conversion, Pipelines, ExactStreams);
+	};
 
-	// Calculate precision loss due to floating point representation
-	// UE uses single precision floats for FVector in many cases, but we use double for calculations
-	// Precision degrades as we move away from origin
-	// At 1 km: ~0.01 cm precision
-	// At 10 km: ~0.1 cm precision
-	// At 100 km: ~1 cm precision
-	// At 1000 km: ~10 cm precision
-	
-	const double BaselinePrecision = 0.01; // 0.01 cm at origin
-	const double PrecisionDegradationFactor = 1.0e-5; // Precision loss per cm of distance
-	
-	Precision.PrecisionCentimeters = BaselinePrecision + (DistanceCm * PrecisionDegradationFactor);
+	// The error is measured in meters, whatever the output coordinate system
+	const double EquatorialRadius = Impl->GeographicEllipsoid.Radii.X;
+	auto ErrorMetric = [Conversion, EquatorialRadius](const FVector& Exact, const FVector& Approximate) -> double
+	{
+		switch (Conversion)
+		{
+		case EGeoConversion::ProjectedToEngine:
+		case EGeoConversion::GeographicToEngine:
+		case EGeoConversion::ECEFToEngine:
+			return FVector::Distance(Exact, Approximate) * 0.01;
+
+		case EGeoConversion::EngineToGeographic:
+		case EGeoConversion::ProjectedToGeographic:
+		case EGeoConversion::ECEFToGeographic:
+		{
+			const double North = FMathd::DegToRad * (Approximate.Y - Exact.Y) * EquatorialRadius;
+			const double East = FMathd::DegToRad * (Approximate.X - Exact.X) * EquatorialRadius * FMathd::Cos(FMathd::DegToRad * Exact.Y);
+			return FVector(East, North, Approximate.Z - Exact.Z).Size();
+		}
 
-	// Determine rebasing threshold
-	// Recommend rebasing when precision exceeds 10 cm (useful for most GIS applications)
-	const double RebasingThresholdCm = 10.0;
-	Precision.bRequiresRebasing = Precision.PrecisionCentimeters > RebasingThresholdCm;
+		default:
+			return FVector::Distance(Exact, Approximate);
+		}
+	};
 
-	// Generate recommendation
-	if (!Precision.bRequiresRebasing)
-	{
-		Precision.Recommendation = FString::Printf(
-			TEXT("Precision is good (%.2f cm). No rebasing needed."),
-			Precision.PrecisionCentimeters);
-	}
-	else if (Precision.PrecisionCentimeters < 50.0)
+	FBox DataBounds(ForceInit);
+	for (int32 i = 0; i < Streams.Num; ++i)
 	{
-		Precision.Recommendation = FString::Printf(
-			TEXT("Precision is degrading (%.2f cm). Consider rebasing soon."),
-			Precision.PrecisionCentimeters);
+		DataBounds += Streams.GetVector(i);
 	}
-	else if (Precision.PrecisionCentimeters < 100.0)
+
+	// Reuse the previous approximation if it covers the data
+	TSharedPtr<FGeoApproximateTransformer> Transformer;
 	{
-		Precision.Recommendation = FString::Printf(
-			TEXT("Precision is poor (%.2f cm). Rebasing recommended."),
-			Precision.PrecisionCentimeters);
+		FScopeLock Lock(&Impl->ApproximateTransformerMutex);
+		if (Impl->ApproximateTransformer.IsValid() && Impl->ApproximateConversion == Conversion
+			&& Impl->ApproximateTransformer->GetMaxError() == ApproximateBatchesMaxErrorMeters && Impl->ApproximateTransformer->Contains(DataBounds))
+		{
+			Transformer = Impl->ApproximateTransformer;
+		}
 	}
-	else
+	if (!Transformer.IsValid())
 	{
-		Precision.Recommendation = FString::Printf(
-			TEXT("Precision is critical (%.2f cm). Rebasing strongly recommended!"),
-			Precision.PrecisionCentimeters);
-	}
+		GEOREFERENCING_SCOPE(BuildApproximation);
 
-	return Precision;
-}
+		Transformer = MakeShared<FGeoApproximateTransformer>();
+		Transformer->Build(DataBounds, ApproximateBatchesMaxErrorMeters, GeoReferencingApproximationMaxDepth, ExactTransform, ErrorMetric);
 
-double AGeoReferencingSystem::GetRecommendedRebasingDistanceKm()
-{
-	// Based on the precision degradation model, calculate the distance where precision reaches 10 cm
-	const double BaselinePrecision = 0.01; // 0.01 cm at origin
-	const double PrecisionDegradationFactor = 1.0e-5;
-	const double RebasingThresholdCm = 10.0;
-	
-	// Solve: RebasingThresholdCm = BaselinePrecision + (DistanceCm * PrecisionDegradationFactor)
-	double DistanceCm = (RebasingThresholdCm - BaselinePrecision) / PrecisionDegradationFactor;
-	double DistanceKm = DistanceCm / 100000.0; // Convert cm to km
-	
-	return DistanceKm;
-}
+		FScopeLock Lock(&Impl->ApproximateTransformerMutex);
+		Impl->ApproximateTransformer = Transformer;
+		Impl->ApproximateConversion = Conversion;
+	}
 
-bool AGeoReferencingSystem::ShouldRebaseAtLocation(const FVector& EngineCoordinates)
-{
-	FCoordinatePrecision Precision = GetPrecisionAtLocation(EngineCoordinates);
-	return Precision.bRequiresRebasing;
-}
+	Transformer->Transform(Streams, ExactTransform);
 
-void AGeoReferencingSystem::ProjectedToGeographic(const FVector& ProjectedCoordinates, FGeographicCoordinates& GeographicCoordinates)
-{
-	PJ_COORD input, output;
-	input = proj_coord(ProjectedCoordinates.X, ProjectedCoordinates.Y, ProjectedCoordinates.Z, 0);
+	// Speedup estimated against the exact conversion of all the points, timed on the samples
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	const double ExactSecondsPerPoint = Transformer->GetExactSamplesSeconds() / FMath::Max(1, Transformer->GetNumExactSamples());
+	const double Speedup = ElapsedSeconds > 0.0 ? ExactSecondsPerPoint * Streams.Num / ElapsedSeconds : 0.0;
 
-	output = proj_trans(Impl->ProjProjectedToGeographic, PJ_FWD, input);
-	GeographicCoordinates.Latitude = output.lpz.phi;
-	GeographicCoordinates.Longitude = output.lpz.lam;
-	GeographicCoordinates.Altitude = output.lpz.z;
+	FScopeLock Lock(&StatsMutex);
+	PerformanceStats.ApproximationMaxErrorMeters = Transformer->GetMeasuredMaxError();
+	PerformanceStats.ApproximationSpeedup = Speedup;
 }
 
-void AGeoReferencingSystem::GeographicToProjected(const FGeographicCoordinates& GeographicCoordinates, FVector& ProjectedCoordinates)
+void AGeoReferencingSystem::TransformBatch(EGeoConversion Conversion, FGeoCoordinateBuffer& Coordinates)
 {
-	PJ_COORD input, output;
-	input = proj_coord(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude, GeographicCoordinates.Altitude, 0);
-
-	output = proj_trans(Impl->ProjProjectedToGeographic, PJ_INV, input);
-	ProjectedCoordinates.X = output.xyz.x;
-	ProjectedCoordinates.Y = output.xyz.y;
-	ProjectedCoordinates.Z = output.xyz.z;
+	TransformBatch(Conversion, FGeoCoordinateStreams::Make(Coordinates));
 }
 
-void AGeoReferencingSystem::ProjectedToECEF(const FVector& ProjectedCoordinates, FVector& ECEFCoordinates)
+void AGeoReferencingSystem::TransformBatch(EGeoConversion Conversion, const FGeoCoordinateStreams& Coordinates)
 {
-	PJ_COORD input, output;
-	input = proj_coord(ProjectedCoordinates.X, ProjectedCoordinates.Y, ProjectedCoordinates.Z, 0);
+	GEOREFERENCING_SCOPE(BatchTransform);
 
-	output = proj_trans(Impl->ProjProjectedToECEF, PJ_FWD, input);
-	ECEFCoordinates.X = output.xyz.x;
-	ECEFCoordinates.Y = output.xyz.y;
-	ECEFCoordinates.Z = output.xyz.z;
-}
+	// Track performance
+	double StartTime = FPlatformTime::Seconds();
 
-void AGeoReferencingSystem::ECEFToProjected(const FVector& ECEFCoordinates, FVector& ProjectedCoordinates)
-{
-	PJ_COORD input, output;
-	input = proj_coord(ECEFCoordinates.X, ECEFCoordinates.Y, ECEFCoordinates.Z, 0);
+	TransformStreamsBatch(Conversion, Impl->GetPipelines(), Coordinates);
 
-	output = proj_trans(Impl->ProjProjectedToECEF, PJ_INV, input);
-	ProjectedCoordinates.X = output.xyz.x;
-	ProjectedCoordinates.Y = output.xyz.y;
-	ProjectedCoordinates.Z = output.xyz.z;
+	// Update performance stats
+	RecordBatchStats(Conversion, Coordinates.Num, (FPlatformTime::Seconds() - StartTime) * 1000000.0);
 }
 
-void AGeoReferencingSystem::GeographicToECEF(const FGeographicCoordinates& GeographicCoordinates, FVector& ECEFCoordinates)
+void AGeoReferencingSystem::TransformBatch(
+	EGeoConversion Conversion,
+	TConstArrayView<double> InX, TConstArrayView<double> InY, TConstArrayView<double> InZ,
+	TArrayView<double> OutX, TArrayView<double> OutY, TArrayView<double> OutZ)
 {
-	PJ_COORD input, output;
-	input = proj_coord(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude, GeographicCoordinates.Altitude, 0);
+	GEOREFERENCING_SCOPE(BatchTransform);
 
-	output = proj_trans(Impl->ProjGeographicToECEF, PJ_FWD, input);
-	ECEFCoordinates.X = output.xyz.x;
-	ECEFCoordinates.Y = output.xyz.y;
-	ECEFCoordinates.Z = output.xyz.z;
-}
+	const int32 Num = InX.Num();
+	if (InY.Num() != Num || InZ.Num() != Num || OutX.Num() != Num || OutY.Num() != Num || OutZ.Num() != Num)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("TransformBatch: all the coordinate arrays must have the same size"));
+		return;
+	}
 
-void AGeoReferencingSystem::ECEFToGeographic(const FVector& ECEFCoordinates, FGeographicCoordinates& GeographicCoordinates)
-{
-	PJ_COORD input, output;
-	input = proj_coord(ECEFCoordinates.X, ECEFCoordinates.Y, ECEFCoordinates.Z, 0);
+	// Track performance
+	double StartTime = FPlatformTime::Seconds();
 
-	output = proj_trans(Impl->ProjGeographicToECEF, PJ_INV, input);
-	GeographicCoordinates.Latitude = output.lpz.phi;
-	GeographicCoordinates.Longitude = output.lpz.lam;
-	GeographicCoordinates.Altitude = output.lpz.z;
-}
+	// The conversion runs in place, in the output arrays
+	auto CopyInputToOutput = [Num](const double* Input, double* Output)
+	{
+		if (Input != Output)
+		{
+			FMemory::Memcpy(Output, Input, Num * sizeof(double));
+		}
+	};
+	CopyInputToOutput(InX.GetData(), OutX.GetData());
+	CopyInputToOutput(InY.GetData(), OutY.GetData());
+	CopyInputToOutput(InZ.GetData(), OutZ.GetData());
 
-// ENU & Transforms
+	TransformStreamsBatch(Conversion, Impl->GetPipelines(), FGeoCoordinateStreams::Make(OutX, OutY, OutZ));
 
-void AGeoReferencingSystem::GetENUVectorsAtEngineLocation(const FVector& EngineCoordinates, FVector& East, FVector& North, FVector& Up)
-{
-	FVector ECEFLocation;
-	EngineToECEF(EngineCoordinates, ECEFLocation);
-	GetENUVectorsAtECEFLocation(ECEFLocation, East, North, Up);
+	// Update performance stats
+	RecordBatchStats(Conversion, Num, (FPlatformTime::Seconds() - StartTime) * 1000000.0);
 }
 
-void AGeoReferencingSystem::GetENUVectorsAtProjectedLocation(const FVector& ProjectedCoordinates, FVector& East, FVector& North, FVector& Up)
+void AGeoReferencingSystem::EngineToECEFBatch(
+	TConstArrayView<double> EngineX, TConstArrayView<double> EngineY, TConstArrayView<double> EngineZ,
+	TArrayView<double> ECEFX, TArrayView<double> ECEFY, TArrayView<double> ECEFZ)
 {
-	FVector ECEFLocation;
-	ProjectedToECEF(ProjectedCoordinates, ECEFLocation);
-	GetENUVectorsAtECEFLocation(ECEFLocation, East, North, Up);
+	TransformBatch(EGeoConversion::EngineToECEF, EngineX, EngineY, EngineZ, ECEFX, ECEFY, ECEFZ);
 }
 
-void AGeoReferencingSystem::GetENUVectorsAtGeographicLocation(const FGeographicCoordinates& GeographicCoordinates, FVector& East, FVector& North, FVector& Up)
+void AGeoReferencingSystem::ECEFToEngineBatch(
+	TConstArrayView<double> ECEFX, TConstArrayView<double> ECEFY, TConstArrayView<double> ECEFZ,
+	TArrayView<double> EngineX, TArrayView<double> EngineY, TArrayView<double> EngineZ)
 {
-	FVector ECEFLocation;
-	GeographicToECEF(GeographicCoordinates, ECEFLocation);
-	GetENUVectorsAtECEFLocation(ECEFLocation, East, North, Up);
+	TransformBatch(EGeoConversion::ECEFToEngine, ECEFX, ECEFY, ECEFZ, EngineX, EngineY, EngineZ);
 }
 
-void AGeoReferencingSystem::GetENUVectorsAtECEFLocation(const FVector& ECEFCoordinates, FVector& East, FVector& North, FVector& Up)
+// Asynchronous Batch Transformations
+
+// Number of points converted between two cancellation checks and progress updates
+static constexpr int32 GeoReferencingAsyncBatchStepSize = 16 * GeoReferencingBatchChunkSize;
+
+TFuture<bool> AGeoReferencingSystem::TransformBatchAsync(EGeoConversion Conversion, TSharedRef<FGeoCoordinateBuffer> Coordinates, TSharedPtr<FGeoBatchTaskHandle> Task)
 {
-	// Compute Tangent matrix at ECEF location
-	FEllipsoid& Ellipsoid = Impl->GeographicEllipsoid;
+	// Initialize() and the destruction wait for the registered batches on the game thread : a registration from another thread could slip in after their wait
+	check(IsInGameThread());
 
-	if (bOriginLocationInProjectedCRS)
+	TSharedRef<FGeoBatchTaskHandle> TaskHandle = Task.IsValid() ? Task.ToSharedRef() : MakeShared<FGeoBatchTaskHandle>();
+	TaskHandle->Start(Coordinates->Num());
+
+	// Converted with the settings of submission time : origin rebases publish a new snapshot without waiting for the task
+	const FGeoTransformerSnapshotPtr Snapshot = GetTransformerSnapshot();
+	if (!Snapshot.IsValid())
 	{
-		Ellipsoid = Impl->ProjectedEllipsoid;
+		UE_LOG(LogGeoReferencing, Warning, TEXT("TransformBatchAsync could not start, the settings are not applied"));
+		return MakeFulfilledPromise<bool>(false).GetFuture();
 	}
-	FMatrix WorldFrameToECEFFrameAtLocation;
-	WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
 
-	switch (PlanetShape)
-	{
-	case EPlanetShape::RoundPlanet:
+	Impl->RegisterAsyncBatch(TaskHandle);
+
+	return Async(EAsyncExecution::ThreadPool, [this, Conversion, Coordinates, TaskHandle, Snapshot]()
 	{
-		FMatrix UEtoECEF = WorldFrameToECEFFrameAtLocation * Impl->ECEFFrameToWorldFrame * Impl->UEFrameToWorldFrame;
-		UEtoECEF.GetUnitAxes(East, North, Up);
-	}
-	break;
+		GEOREFERENCING_SCOPE(BatchTransform);
 
-	case EPlanetShape::FlatPlanet:
-	default:
-		// PROJ don't provide anything to project direction vectors. Let's do it by hand...
-		FVector EasternPoint = ECEFCoordinates + WorldFrameToECEFFrameAtLocation.TransformVector(FVector(1.0, 0.0, 0.0)); // 1m from origin to the East
-		FVector NorthernPoint = ECEFCoordinates + WorldFrameToECEFFrameAtLocation.TransformVector(FVector(0.0, 1.0, 0.0)); // 1m from origin to the North
-		
-		FVector ProjectedOrigin, ProjectedEastern, ProjectedNorthern;
-		ECEFToProjected(ECEFCoordinates, ProjectedOrigin);
-		ECEFToProjected(EasternPoint, ProjectedEastern);
-		ECEFToProjected(NorthernPoint, ProjectedNorthern);
+		// Track performance
+		double StartTime = FPlatformTime::Seconds();
 
-		FVector EastDirection(ProjectedEastern.X - ProjectedOrigin.X, ProjectedEastern.Y - ProjectedOrigin.Y, ProjectedEastern.Z - ProjectedOrigin.Z);
-		FVector NorthDirection(ProjectedNorthern.X - ProjectedOrigin.X, ProjectedNorthern.Y - ProjectedOrigin.Y, ProjectedNorthern.Z - ProjectedOrigin.Z);
+		const FGeoCoordinateStreams Streams = FGeoCoordinateStreams::Make(*Coordinates);
+		bool bConversionFailed = false;
+		int32 StartIndex = 0;
+		for (; StartIndex < Streams.Num && !TaskHandle->IsCancelRequested(); StartIndex += GeoReferencingAsyncBatchStepSize)
+		{
+			const int32 Num = FMath::Min(GeoReferencingAsyncBatchStepSize, Streams.Num - StartIndex);
+			if (!Snapshot->Transform(Conversion, Streams.Slice(StartIndex, Num)))
+			{
+				UE_LOG(LogGeoReferencing, Warning, TEXT("TransformBatchAsync failed to convert the points after %d points"), StartIndex);
+				bConversionFailed = true;
+				break;
+			}
+			TaskHandle->AddConverted(Num);
+		}
+		const bool bCompleted = !bConversionFailed && StartIndex >= Streams.Num;
 
-		EastDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
-		NorthDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
+		// Update performance stats
+		RecordBatchStats(Conversion, FMath::Min(StartIndex, Streams.Num), (FPlatformTime::Seconds() - StartTime) * 1000000.0);
 
-		East = FVector(EastDirection.X, -EastDirection.Y, EastDirection.Z);
-		North = FVector(NorthDirection.X, -NorthDirection.Y, NorthDirection.Z);
-		Up = FVector::CrossProduct(North, East);
-		break;
-	}
+		// The system waits for this unregistration before changing its settings or being destroyed : nothing can follow it
+		Impl->UnregisterAsyncBatch(TaskHandle);
+		return bCompleted;
+	});
 }
 
-void AGeoReferencingSystem::GetECEFENUVectorsAtECEFLocation(const FVector& ECEFCoordinates, FVector& ECEFEast, FVector& ECEFNorth, FVector& ECEFUp)
+TSharedRef<FGeoBatchTaskHandle> AGeoReferencingSystem::TransformBatchAsync(EGeoConversion Conversion, TSharedRef<FGeoCoordinateBuffer> Coordinates, FOnGeoBatchCompleted OnCompleted, TSharedPtr<FGeoBatchTaskHandle> Task)
 {
-	// Compute Tangent matrix at ECEF location
-	FEllipsoid& Ellipsoid = Impl->GeographicEllipsoid;
-	
-	if (bOriginLocationInProjectedCRS)
+	TSharedRef<FGeoBatchTaskHandle> TaskHandle = Task.IsValid() ? Task.ToSharedRef() : MakeShared<FGeoBatchTaskHandle>();
+
+	// The future completes on the worker : the delegate is forwarded to the game thread
+	TransformBatchAsync(Conversion, Coordinates, TaskHandle).Next([OnCompleted = MoveTemp(OnCompleted)](bool bSuccess)
 	{
-		Ellipsoid = Impl->ProjectedEllipsoid;
-	}
-	
-	FMatrix WorldFrameToECEFFrameAtLocation;
-	WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
-	WorldFrameToECEFFrameAtLocation.GetUnitAxes(ECEFEast, ECEFNorth, ECEFUp);
-}
+		AsyncTask(ENamedThreads::GameThread, [OnCompleted, bSuccess]()
+		{
+			OnCompleted.ExecuteIfBound(bSuccess);
+		});
+	});
 
-FTransform AGeoReferencingSystem::GetTangentTransformAtEngineLocation(const FVector& EngineCoordinates)
-{
-	FVector ECEFLocation;
-	EngineToECEF(EngineCoordinates, ECEFLocation);
-	return GetTangentTransformAtECEFLocation(ECEFLocation);
+	return TaskHandle;
 }
 
-FTransform AGeoReferencingSystem::GetTangentTransformAtProjectedLocation(const FVector& ProjectedCoordinates)
+TFuture<TArray<FVector>> AGeoReferencingSystem::TransformBatchAsync(EGeoConversion Conversion, const TArray<FVector>& Coordinates, TSharedPtr<FGeoBatchTaskHandle> Task)
 {
-	FVector ECEFLocation;
-	ProjectedToECEF(ProjectedCoordinates, ECEFLocation);
-	return GetTangentTransformAtECEFLocation(ECEFLocation);
-}
+	TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+	Buffer->CopyFrom(Coordinates);
 
-FTransform AGeoReferencingSystem::GetTangentTransformAtGeographicLocation(const FGeographicCoordinates& GeographicCoordinates)
-{
-	FVector ECEFLocation;
-	GeographicToECEF(GeographicCoordinates, ECEFLocation);
-	return GetTangentTransformAtECEFLocation(ECEFLocation);
+	return TransformBatchAsync(Conversion, Buffer, Task).Next([Buffer](bool bSuccess)
+	{
+		TArray<FVector> Result;
+		if (bSuccess)
+		{
+			Result.SetNum(Buffer->Num());
+			Buffer->CopyTo(Result);
+		}
+		return Result;
+	});
 }
 
-FTransform AGeoReferencingSystem::GetTangentTransformAtECEFLocation(const FVector& ECEFCoordinates)
+TFuture<TArray<FVector>> AGeoReferencingSystem::GeographicToEngineBatchAsync(const TArray<FGeographicCoordinates>& GeographicCoordinates, TSharedPtr<FGeoBatchTaskHandle> Task)
 {
-	if (PlanetShape == EPlanetShape::RoundPlanet)
+	TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+	Buffer->CopyFrom(GeographicCoordinates);
+
+	return TransformBatchAsync(EGeoConversion::GeographicToEngine, Buffer, Task).Next([Buffer](bool bSuccess)
 	{
-		// Compute Tangent matrix at ECEF location
-		FEllipsoid& Ellipsoid = Impl->GeographicEllipsoid;
-		if (bOriginLocationInProjectedCRS)
+		TArray<FVector> Result;
+		if (bSuccess)
 		{
-			Ellipsoid = Impl->ProjectedEllipsoid;
+			Result.SetNum(Buffer->Num());
+			Buffer->CopyTo(Result);
 		}
-		FMatrix WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
-		
+		return Result;
+	});
+}
 
-		FMatrix UEtoECEF = Impl->UEFrameToWorldFrame * WorldFrameToECEFFrameAtLocation * Impl->ECEFFrameToWorldFrame * Impl->WorldFrameToUEFrame; 
-		FVector UEOrigin;
-		ECEFToEngine(ECEFCoordinates, UEOrigin);
-		UEtoECEF.SetOrigin(UEOrigin);
+TFuture<TArray<FGeographicCoordinates>> AGeoReferencingSystem::EngineToGeographicBatchAsync(const TArray<FVector>& EngineCoordinates, TSharedPtr<FGeoBatchTaskHandle> Task)
+{
+	TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+	Buffer->CopyFrom(EngineCoordinates);
 
-		return FTransform(UEtoECEF);
-	}
-	else
+	return TransformBatchAsync(EGeoConversion::EngineToGeographic, Buffer, Task).Next([Buffer](bool bSuccess)
 	{
-		FVector East, North, Up, UEOrigin;
-		GetENUVectorsAtECEFLocation(ECEFCoordinates, East, North, Up);
-		ECEFToEngine(ECEFCoordinates, UEOrigin);
-		FMatrix TransformMatrix(East, North, Up, UEOrigin);
-		return FTransform(TransformMatrix);
-	}
+		TArray<FGeographicCoordinates> Result;
+		if (bSuccess)
+		{
+			Result.SetNum(Buffer->Num());
+			Buffer->CopyTo(Result);
+		}
+		return Result;
+	});
 }
 
-FTransform AGeoReferencingSystem::GetPlanetCenterTransform()
+// Latent Blueprint action waiting for an asynchronous batch, and writing its result to the node outputs once complete
+class FGeoBatchLatentAction : public FPendingLatentAction
 {
-	// Compute Origin location in ECEF. 
-	if (PlanetShape == EPlanetShape::RoundPlanet)
+public:
+	FGeoBatchLatentAction(
+		TFuture<bool>&& InFuture,
+		TSharedRef<FGeoCoordinateBuffer> InCoordinates,
+		TSharedRef<FGeoBatchTaskHandle> InTask,
+		TFunction<void(const FGeoCoordinateBuffer&)>&& InWriteOutput,
+		bool& bInSuccess,
+		const FLatentActionInfo& LatentInfo)
+		: Future(MoveTemp(InFuture))
+		, Coordinates(InCoordinates)
+		, Task(InTask)
+		, WriteOutput(MoveTemp(InWriteOutput))
+		, bSuccess(bInSuccess)
+		, ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
 	{
-		if (bOriginAtPlanetCenter)
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (!Future.IsReady())
 		{
-			return FTransform::Identity;
+			return;
 		}
-		else
-		{
-			FMatrix TransformMatrix = Impl->UEFrameToWorldFrame * Impl->ECEFFrameToWorldFrame * Impl->WorldFrameToUEFrame;
-			// Don't go to transform yet, we must stay in double to apply the rebasing offset. 
-
-			// Get Origin, and convert UE units to meters, invert the Y coordinate because of left-handed UE Frame
-			FVector UEOrigin = TransformMatrix.GetOrigin() * FVector(100.0, 100.0, 100.0);
-			TransformMatrix.SetOrigin(UEOrigin);
 
-			return FTransform(TransformMatrix);
+		bSuccess = Future.Get();
+		if (bSuccess)
+		{
+			WriteOutput(*Coordinates);
 		}
+		Response.FinishAndTriggerIf(true, ExecutionFunction, OutputLink, CallbackTarget);
 	}
-	else
+
+	// The outputs belong to the calling graph : once it is gone, the result is useless
+	virtual void NotifyObjectDestroyed() override { Task->Cancel(); }
+	virtual void NotifyActionAborted() override { Task->Cancel(); }
+
+#if WITH_EDITOR
+	virtual FString GetDescription() const override
 	{
-		// Makes not sense in Flat planet mode... 
-		return FTransform::Identity;
+		return FString::Printf(TEXT("Converting %d coordinates (%.0f%%)"), Task->GetNumCoordinates(), Task->GetProgress() * 100.0f);
 	}
-}
+#endif
 
-// Public PROJ Utilities
+private:
+	TFuture<bool> Future;
+	TSharedRef<FGeoCoordinateBuffer> Coordinates;
+	TSharedRef<FGeoBatchTaskHandle> Task;
+	TFunction<void(const FGeoCoordinateBuffer&)> WriteOutput;
+	bool& bSuccess;
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+};
 
-bool AGeoReferencingSystem::IsCRSStringValid(FString CRSString, FString& Error)
+static void StartGeoBatchLatentAction(
+	AGeoReferencingSystem* System,
+	EGeoConversion Conversion,
+	TSharedRef<FGeoCoordinateBuffer> Coordinates,
+	TFunction<void(const FGeoCoordinateBuffer&)>&& WriteOutput,
+	bool& bSuccess,
+	const FLatentActionInfo& LatentInfo)
 {
-	if (Impl->ProjContext == nullptr)
+	UWorld* World = System->GetWorld();
+	if (World == nullptr)
 	{
-		Error = FString("Proj Context has not been initialized");
-		return false;
+		bSuccess = false;
+		return;
 	}
 
-	// Try to create a CRS from this string
-	FTCHARToUTF8 Convert(*CRSString);
-	const ANSICHAR* UtfString = Convert.Get();
-	PJ* CRS = proj_create(Impl->ProjContext, UtfString);
-
-	if (CRS == nullptr)
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	if (LatentActionManager.FindExistingAction<FGeoBatchLatentAction>(LatentInfo.CallbackTarget, LatentInfo.UUID) != nullptr)
 	{
-		int ErrorNumber = proj_context_errno(Impl->ProjContext);
-		Error = FString(proj_errno_string(ErrorNumber));
-		return false;
+		// Same node triggered again while running : keep the conversion already in progress
+		return;
 	}
 
-	proj_destroy(CRS);
-	return true;
+	TSharedRef<FGeoBatchTaskHandle> Task = MakeShared<FGeoBatchTaskHandle>();
+	TFuture<bool> Future = System->TransformBatchAsync(Conversion, Coordinates, Task);
+	LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID,
+		new FGeoBatchLatentAction(MoveTemp(Future), Coordinates, Task, MoveTemp(WriteOutput), bSuccess, LatentInfo));
 }
 
-// Ellipsoid
+void AGeoReferencingSystem::GeographicToEngineBatchLatent(
+	const TArray<FGeographicCoordinates>& GeographicCoordinates,
+	TArray<FVector>& EngineCoordinates,
+	bool& bSuccess,
+	FLatentActionInfo LatentInfo)
+{
+	TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+	Buffer->CopyFrom(GeographicCoordinates);
 
-double AGeoReferencingSystem::GetGeographicEllipsoidMaxRadius()
+	StartGeoBatchLatentAction(this, EGeoConversion::GeographicToEngine, Buffer,
+		[&EngineCoordinates](const FGeoCoordinateBuffer& Result) { EngineCoordinates.SetNum(Result.Num()); Result.CopyTo(EngineCoordinates); },
+		bSuccess, LatentInfo);
+}
+
+void AGeoReferencingSystem::EngineToGeographicBatchLatent(
+	const TArray<FVector>& EngineCoordinates,
+	TArray<FGeographicCoordinates>& GeographicCoordinates,
+	bool& bSuccess,
+	FLatentActionInfo LatentInfo)
 {
-	return Impl->GeographicEllipsoid.GetMaximumRadius();
+	TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+	Buffer->CopyFrom(EngineCoordinates);
+
+	StartGeoBatchLatentAction(this, EGeoConversion::EngineToGeographic, Buffer,
+		[&GeographicCoordinates](const FGeoCoordinateBuffer& Result) { GeographicCoordinates.SetNum(Result.Num()); Result.CopyTo(GeographicCoordinates); },
+		bSuccess, LatentInfo);
 }
 
-double AGeoReferencingSystem::GetGeographicEllipsoidMinRadius()
+void AGeoReferencingSystem::TransformBatchLatent(
+	EGeoConversion Conversion,
+	const TArray<FVector>& Coordinates,
+	TArray<FVector>& OutCoordinates,
+	bool& bSuccess,
+	FLatentActionInfo LatentInfo)
 {
-	return Impl->GeographicEllipsoid.GetMinimumRadius();
+	TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+	Buffer->CopyFrom(Coordinates);
+
+	StartGeoBatchLatentAction(this, Conversion, Buffer,
+		[&OutCoordinates](const FGeoCoordinateBuffer& Result) { OutCoordinates.SetNum(Result.Num()); Result.CopyTo(OutCoordinates); },
+		bSuccess, LatentInfo);
 }
 
-double AGeoReferencingSystem::GetProjectedEllipsoidMaxRadius()
+void AGeoReferencingSystem::CancelAsyncBatches()
 {
-	return Impl->ProjectedEllipsoid.GetMaximumRadius();
+	Impl->CancelAsyncBatches();
 }
 
-double AGeoReferencingSystem::GetProjectedEllipsoidMinRadius()
+float AGeoReferencingSystem::GetAsyncBatchesProgress() const
 {
-	return Impl->ProjectedEllipsoid.GetMinimumRadius();
+	return Impl->GetAsyncBatchesProgress();
 }
 
-bool AGeoReferencingSystem::FGeoReferencingSystemInternals::GetEllipsoid(FString CRSString, FEllipsoid& Ellipsoid)
+// Streaming Transformations
+
+bool AGeoReferencingSystem::TransformArchive(EGeoConversion Conversion, FArchive& Reader, FArchive& Writer, const FGeoStreamingTransformSettings& Settings, FGeoStreamingTransformStats& OutStats)
 {
-	FTCHARToUTF8 ConvertCRSString(*CRSString);
-	const ANSICHAR* CRS = ConvertCRSString.Get();
-	bool bSuccess = true;
+	GEOREFERENCING_SCOPE(StreamingTransform);
 
-	PJ* CRSPJ = proj_create(ProjContext, CRS);
-	if (CRSPJ != nullptr)
+	static_assert(sizeof(FVector) == 3 * sizeof(double), "Points are read and written as FVector");
+
+	OutStats = FGeoStreamingTransformStats();
+	const double StartTime = FPlatformTime::Seconds();
+
+	const int64 NumBytes = Reader.TotalSize() - Reader.Tell();
+	if (Reader.TotalSize() < 0 || NumBytes % sizeof(FVector) != 0)
 	{
-		PJ* EllipsoidPJ = proj_get_ellipsoid(ProjContext, CRSPJ);
-		if (EllipsoidPJ != nullptr)
-		{
-			double SemiMajorMetre; // semi-major axis in meter
-			double SemiMinorMetre; // semi-minor axis in meter
-			double InvFlattening;  // inverse flattening.
-			int IsSemiMinorComputed; // if the semi-minor value was computed. If FALSE, its value comes from the definition
+		UE_LOG(LogGeoReferencing, Error, TEXT("TransformArchive: the input size must be known and a multiple of %d bytes (X, Y, Z doubles)"), static_cast<int32>(sizeof(FVector)));
+		return false;
+	}
+	OutStats.NumPoints = NumBytes / sizeof(FVector);
 
-			if (proj_ellipsoid_get_parameters(ProjContext, EllipsoidPJ, &SemiMajorMetre, &SemiMinorMetre, &IsSemiMinorComputed, &InvFlattening))
+	const int32 ChunkSize = FMath::Max(Settings.ChunkSize, GeoReferencingBatchChunkSize);
+	const int32 NumWorkers = FMath::Clamp(Settings.NumWorkers, 1, FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads()));
+
+	// The whole stream is converted with the settings of this snapshot : ApplySettings, origin rebasing included, can run meanwhile
+	// without any chunk reading half updated transforms. Each worker leases its PROJ context from the snapshot pool.
+	const FGeoTransformerSnapshotPtr Snapshot = GetTransformerSnapshot();
+	if (!Snapshot.IsValid())
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("TransformArchive: no valid settings to convert with"));
+		return false;
+	}
+
+	// Double buffering : while one chunk is converted on the workers, this thread writes the previous one and reads the next one
+	struct FChunk
+	{
+		TArray<FVector> Points;
+		TFuture<void> Converted;
+		double ConvertSeconds = 0.0;
+		std::atomic<bool> bConversionFailed { false };
+	};
+	FChunk Chunks[2];
+
+	auto ConvertChunk = [Conversion, NumWorkers, &Snapshot](FChunk& Chunk)
+	{
+		GEOREFERENCING_SCOPE(BatchTransform);
+
+		const double ConvertStartTime = FPlatformTime::Seconds();
+
+		const FGeoCoordinateStreams Streams = FGeoCoordinateStreams::Make(MakeArrayView(Chunk.Points));
+		const int32 WorkerSize = FMath::DivideAndRoundUp(Streams.Num, NumWorkers);
+		ParallelFor(NumWorkers, [&](int32 WorkerIndex)
+		{
+			const int32 StartIndex = WorkerIndex * WorkerSize;
+			const int32 Num = FMath::Min(WorkerSize, Streams.Num - StartIndex);
+			if (Num > 0 && !Snapshot->Transform(Conversion, Streams.Slice(StartIndex, Num)))
 			{
-				Ellipsoid = FEllipsoid(SemiMajorMetre, SemiMajorMetre, SemiMinorMetre);
+				Chunk.bConversionFailed.store(true, std::memory_order_relaxed);
 			}
-			else
+		});
+
+		Chunk.ConvertSeconds = FPlatformTime::Seconds() - ConvertStartTime;
+	};
+
+	bool bSuccess = true;
+	int64 NumRead = 0;
+	int32 Current = 0;
+	for (;;)
+	{
+		// Read and start converting the next chunk. Its buffer was written during the previous iteration.
+		FChunk& Chunk = Chunks[Current];
+		const int32 Num = static_cast<int32>(FMath::Min<int64>(ChunkSize, OutStats.NumPoints - NumRead));
+		if (Num > 0)
+		{
+			const double ReadStartTime = FPlatformTime::Seconds();
+			Chunk.Points.SetNumUninitialized(Num, false);
+			Reader.Serialize(Chunk.Points.GetData(), Num * sizeof(FVector));
+			OutStats.ReadSeconds += FPlatformTime::Seconds() - ReadStartTime;
+
+			if (Reader.IsError())
 			{
-				int ErrorNumber = proj_context_errno(ProjContext);
-				FString ProjError = FString(proj_errno_string(ErrorNumber));
-				UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::GetEllipsoid failed in proj_ellipsoid_get_parameters : %s "), *ProjError);
+				UE_LOG(LogGeoReferencing, Error, TEXT("TransformArchive: failed to read the input after %lld points"), NumRead);
 				bSuccess = false;
+				break;
 			}
+			NumRead += Num;
 
-			proj_destroy(EllipsoidPJ);
+			Chunk.Converted = Async(EAsyncExecution::ThreadPool, [&ConvertChunk, &Chunk]() { ConvertChunk(Chunk); });
 		}
-		else
+
+		// Write the previous chunk while this one is converted
+		FChunk& Previous = Chunks[1 - Current];
+		if (Previous.Converted.IsValid())
 		{
-			int ErrorNumber = proj_context_errno(ProjContext);
-			FString ProjError = FString(proj_errno_string(ErrorNumber));
-			UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::GetEllipsoid failed in proj_get_ellipsoid : %s "), *ProjError);
-			bSuccess = false;
+			const double StallStartTime = FPlatformTime::Seconds();
+			Previous.Converted.Wait();
+			Previous.Converted = TFuture<void>();
+			OutStats.StallSeconds += FPlatformTime::Seconds() - StallStartTime;
+			OutStats.ConvertSeconds += Previous.ConvertSeconds;
+
+			if (Previous.bConversionFailed.load(std::memory_order_relaxed))
+			{
+				UE_LOG(LogGeoReferencing, Error, TEXT("TransformArchive: failed to convert the points after %lld points"), OutStats.NumConverted);
+				bSuccess = false;
+				break;
+			}
+
+			const double WriteStartTime = FPlatformTime::Seconds();
+			Writer.Serialize(Previous.Points.GetData(), Previous.Points.Num() * sizeof(FVector));
+			OutStats.WriteSeconds += FPlatformTime::Seconds() - WriteStartTime;
+
+			if (Writer.IsError())
+			{
+				UE_LOG(LogGeoReferencing, Error, TEXT("TransformArchive: failed to write the output after %lld points"), OutStats.NumConverted);
+				bSuccess = false;
+				break;
+			}
+			OutStats.NumConverted += Previous.Points.Num();
+			RecordBatchStats(Conversion, Previous.Points.Num(), Previous.ConvertSeconds * 1000000.0);
+
+			OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+			if (Settings.OnProgress && !Settings.OnProgress(OutStats))
+			{
+				UE_LOG(LogGeoReferencing, Warning, TEXT("TransformArchive stopped after %lld points"), OutStats.NumConverted);
+				bSuccess = false;
+				break;
+			}
 		}
 
-		proj_destroy(CRSPJ);
+		if (Num <= 0)
+		{
+			break;
+		}
+		Current = 1 - Current;
 	}
-	else
+
+	// On failure, a conversion may still be running on a buffer about to go out of scope
+	for (FChunk& Chunk : Chunks)
 	{
-		int ErrorNumber = proj_context_errno(ProjContext);
-		FString ProjError = FString(proj_errno_string(ErrorNumber));
-		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::GetEllipsoid failed in proj_create : %s "), *ProjError);
-		UE_LOG(LogGeoReferencing, Display, TEXT("CRSString was : %s "), *CRSString);
-		bSuccess = false;
+		if (Chunk.Converted.IsValid())
+		{
+			Chunk.Converted.Wait();
+		}
 	}
 
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
 	return bSuccess;
 }
 
-void AGeoReferencingSystem::ApplySettings()
+bool AGeoReferencingSystem::TransformFile(EGeoConversion Conversion, const FString& InputFilename, const FString& OutputFilename, const FGeoStreamingTransformSettings& Settings, FGeoStreamingTransformStats& OutStats)
 {
-	// Apply Projection settings
-
-	// Projected -> Geographic
-	if (Impl->ProjProjectedToGeographic != nullptr)
-	{
-		proj_destroy(Impl->ProjProjectedToGeographic);
-	}
-	Impl->ProjProjectedToGeographic = Impl->GetPROJProjection(ProjectedCRS, GeographicCRS);
-
-	// Projected -> Geocentric
-	if (Impl->ProjProjectedToECEF != nullptr)
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InputFilename));
+	if (!Reader.IsValid())
 	{
-		proj_destroy(Impl->ProjProjectedToECEF);
+		UE_LOG(LogGeoReferencing, Error, TEXT("TransformFile: can't open %s"), *InputFilename);
+		return false;
 	}
-	Impl->ProjProjectedToECEF = Impl->GetPROJProjection(ProjectedCRS, ECEF_EPSG_FSTRING);
 
-	// Geographic -> Geocentric
-	if (Impl->ProjGeographicToECEF != nullptr)
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*OutputFilename));
+	if (!Writer.IsValid())
 	{
-		proj_destroy(Impl->ProjGeographicToECEF);
+		UE_LOG(LogGeoReferencing, Error, TEXT("TransformFile: can't create %s"), *OutputFilename);
+		return false;
 	}
-	Impl->ProjGeographicToECEF = Impl->GetPROJProjection(GeographicCRS, ECEF_EPSG_FSTRING);
-
-	bool bProjectedEllipsoidSuccess = Impl->GetEllipsoid(ProjectedCRS, Impl->ProjectedEllipsoid);
-	bool bGeographicEllipsoidSuccess = Impl->GetEllipsoid(GeographicCRS, Impl->GeographicEllipsoid);
 
-	bool bSuccess = Impl->ProjProjectedToGeographic != nullptr && Impl->ProjProjectedToECEF != nullptr && Impl->ProjGeographicToECEF != nullptr && bProjectedEllipsoidSuccess && bGeographicEllipsoidSuccess;
+	bool bSuccess = TransformArchive(Conversion, *Reader, *Writer, Settings, OutStats);
+	bSuccess &= Writer->Close();
+	Reader->Close();
 
-#if WITH_EDITOR
-	if (!bSuccess)
+	if (bSuccess)
 	{
-		// Show an error notification
-		const FText NotificationErrorText = NSLOCTEXT("GeoReferencing", "GeoReferencingCRSError", "Error in one CRS definition string - Check log");
-		FNotificationInfo Info(NotificationErrorText);
-		Info.ExpireDuration = 2.0f;
-		Info.bUseSuccessFailIcons = true;
-		FSlateNotificationManager::Get().AddNotification(Info);
-		return;
+		UE_LOG(LogGeoReferencing, Log, TEXT("TransformFile: %lld points converted in %.2f s (%.0f points/s, %.1f MB/s)"),
+			OutStats.NumConverted, OutStats.TotalSeconds, OutStats.GetPointsPerSecond(), OutStats.GetMegabytesPerSecond());
 	}
-#endif
+	return bSuccess;
+}
 
-	// Apply Origin settings
+void AGeoReferencingSystem::RecordBatchStats(EGeoConversion Conversion, int32 NumTransformations, double ElapsedMicroseconds)
+{
+	GEOREFERENCING_COUNTER_ADD(PointsConverted, NumTransformations);
 
-	switch (PlanetShape)
+	const uint64 ElapsedNanoseconds = static_cast<uint64>(FMath::Max(ElapsedMicroseconds, 0.0) * 1000.0);
+	Impl->LatencyHistograms[static_cast<int32>(Conversion)].Record(ElapsedNanoseconds, NumTransformations);
+}
+
+// Performance Monitoring
+
+static void FillConversionStats(const FGeoLatencyHistogram::FSnapshot& Snapshot, FGeoConversionStats& ConversionStats)
+{
+	ConversionStats.NumCalls = static_cast<int64>(Snapshot.NumSamples);
+	ConversionStats.TotalTransformations = static_cast<int64>(Snapshot.NumItems);
+	ConversionStats.LatencyP50Microseconds = Snapshot.GetPercentile(0.5) / 1000.0;
+	ConversionStats.LatencyP90Microseconds = Snapshot.GetPercentile(0.9) / 1000.0;
+	ConversionStats.LatencyP99Microseconds = Snapshot.GetPercentile(0.99) / 1000.0;
+	ConversionStats.LatencyP999Microseconds = Snapshot.GetPercentile(0.999) / 1000.0;
+	ConversionStats.MaxLatencyMicroseconds = static_cast<double>(Snapshot.MaxNanoseconds) / 1000.0;
+}
+
+FGeoReferencingStats AGeoReferencingSystem::GetPerformanceStats() const
+{
+	FGeoReferencingStats Stats;
 	{
-	case EPlanetShape::RoundPlanet:
-		// Matrice UE to ECEF :
-		if (bOriginAtPlanetCenter)
+		FScopeLock Lock(&StatsMutex);
+		Stats = PerformanceStats;
+	}
+
+	// Histograms are merged on read, recording never waits for this
+	FGeoLatencyHistogram::FSnapshot Total;
+	for (EGeoConversion Conversion : TEnumRange<EGeoConversion>())
+	{
+		FGeoLatencyHistogram::FSnapshot Snapshot;
+		Impl->LatencyHistograms[static_cast<int32>(Conversion)].AccumulateTo(Snapshot);
+		Impl->LatencyHistograms[static_cast<int32>(Conversion)].AccumulateTo(Total);
+		if (Snapshot.NumSamples == 0)
 		{
-			// Theoritically, we should never use this Identity matrices since the transformations already handle that using a shorter code path, but let's keep consistency  
-			Impl->ECEFFrameToWorldFrame.SetIdentity();
-			Impl->WorldFrameToECEFFrame.SetIdentity();
+			continue;
+		}
+
+		FGeoConversionStats& ConversionStats = Stats.Conversions.AddDefaulted_GetRef();
+		ConversionStats.Conversion = Conversion;
+		FillConversionStats(Snapshot, ConversionStats);
+	}
+	Impl->LatencyHistograms[static_cast<int32>(EGeoConversion::Count)].AccumulateTo(Total);
+
+	FGeoLatencyHistogram::FSnapshot TangentFrames;
+	Impl->TangentFramesLatencyHistogram.AccumulateTo(TangentFrames);
+	FillConversionStats(TangentFrames, Stats.TangentFrames);
+
+	Stats.TotalTransformations = static_cast<int64>(Total.NumItems);
+	Stats.AverageTransformTimeMicroseconds = Total.NumItems > 0 ? static_cast<double>(Total.SumNanoseconds) / 1000.0 / static_cast<double>(Total.NumItems) : 0.0;
+	Stats.MaxTransformTimeMicroseconds = static_cast<double>(Total.MaxItemNanoseconds) / 1000.0;
+	Stats.LatencyP50Microseconds = Total.GetPercentile(0.5) / 1000.0;
+	Stats.LatencyP90Microseconds = Total.GetPercentile(0.9) / 1000.0;
+	Stats.LatencyP99Microseconds = Total.GetPercentile(0.99) / 1000.0;
+	Stats.LatencyP999Microseconds = Total.GetPercentile(0.999) / 1000.0;
+
+	Stats.CacheHits = static_cast<int32>(FMath::Min<int64>(Impl->CoordinateCache.GetNumHits(), MAX_int32));
+	Stats.CacheMisses = static_cast<int32>(FMath::Min<int64>(Impl->CoordinateCache.GetNumMisses(), MAX_int32));
+	return Stats;
+}
+
+void AGeoReferencingSystem::ResetPerformanceStats()
+{
+	{
+		FScopeLock Lock(&StatsMutex);
+		PerformanceStats = FGeoReferencingStats();
+	}
+	for (FGeoLatencyHistogram& Histogram : Impl->LatencyHistograms)
+	{
+		Histogram.Reset();
+	}
+	Impl->TangentFramesLatencyHistogram.Reset();
+	Impl->CoordinateCache.ResetCounters();
+}
+
+// Coordinate Precision Calculator
+
+double AGeoReferencingSystem::GetSinglePrecisionSpacing(double ValueCentimeters)
+{
+	// 24 bits mantissa : the spacing is 2^(e-23) for values in [2^e, 2^(e+1)). Below 1 cm it is negligible for our purpose.
+	const double Magnitude = FMath::Max(FMath::Abs(ValueCentimeters), 1.0);
+	return FMath::Pow(2.0, FMath::FloorToDouble(FMath::Log2(Magnitude)) - 23.0);
+}
+
+FCoordinatePrecision AGeoReferencingSystem::GetPrecisionAtLocation(const FVector& EngineCoordinates)
+{
+	FCoordinatePrecision Precision;
+
+	// Calculate distance from origin in centimeters
+	double DistanceCm = EngineCoordinates.Size();
+	Precision.DistanceFromOriginKm = DistanceCm / 100000.0; // Convert cm to km
+
+	// Positions are doubles in the engine, but still go through single precision floats in physics, render proxies and animation.
+	// The precision is the float spacing of the largest component :
+	// At 1 km: ~0.008 cm
+	// At 10 km: ~0.06 cm
+	// At 100 km: ~1 cm
+	// At 1000 km: ~8 cm
+	Precision.PrecisionCentimeters = GetSinglePrecisionSpacing(EngineCoordinates.GetAbsMax());
+	Precision.bRequiresRebasing = Precision.PrecisionCentimeters > RebasingPrecisionThresholdCentimeters;
+
+	// Generate recommendation
+	if (!Precision.bRequiresRebasing)
+	{
+		Precision.Recommendation = FString::Printf(
+			TEXT("Precision is good (%.4f cm). No rebasing needed."),
+			Precision.PrecisionCentimeters);
+	}
+	else if (Precision.PrecisionCentimeters <= 4.0 * RebasingPrecisionThresholdCentimeters)
+	{
+		Precision.Recommendation = FString::Printf(
+			TEXT("Precision is degrading (%.4f cm). Consider rebasing soon."),
+			Precision.PrecisionCentimeters);
+	}
+	else if (Precision.PrecisionCentimeters <= 16.0 * RebasingPrecisionThresholdCentimeters)
+	{
+		Precision.Recommendation = FString::Printf(
+			TEXT("Precision is poor (%.4f cm). Rebasing recommended."),
+			Precision.PrecisionCentimeters);
+	}
+	else
+	{
+		Precision.Recommendation = FString::Printf(
+			TEXT("Precision is critical (%.4f cm). Rebasing strongly recommended!"),
+			Precision.PrecisionCentimeters);
+	}
+
+	return Precision;
+}
+
+double AGeoReferencingSystem::GetRecommendedRebasingDistanceKm()
+{
+	// The spacing doubles at each power of 2 : the last binade where it stays below the threshold ends at 2^(23 + floor(log2(Threshold)) + 1)
+	const double Threshold = FMath::Max(RebasingPrecisionThresholdCentimeters, UE_DOUBLE_SMALL_NUMBER);
+	double DistanceCm = FMath::Pow(2.0, 24.0 + FMath::FloorToDouble(FMath::Log2(Threshold)));
+	double DistanceKm = DistanceCm / 100000.0; // Convert cm to km
+
+	return DistanceKm;
+}
+
+bool AGeoReferencingSystem::RebaseOrigin(const FVector& EngineCoordinates, FTransform& OldToNewEngine)
+{
+	OldToNewEngine = FTransform::Identity;
+	if (PlanetShape == EPlanetShape::RoundPlanet && bOriginAtPlanetCenter)
+	{
+		UE_LOG(LogGeoReferencing, Warning, TEXT("The origin is at the planet center, it can't be rebased"));
+		return false;
+	}
+
+	Impl->WaitForInitialization();
+
+	// Both engine frames are rigid, so the transform between them is given by a point and 3 axes, taken 1 km long around the new origin.
+	// They are expressed in a CRS that doesn't depend on the origin, then converted back to the new engine frame.
+	const bool bRoundPlanet = PlanetShape == EPlanetShape::RoundPlanet;
+	const double AxisLength = 100000.0;
+	const FVector EnginePoints[4] =
+	{
+		EngineCoordinates,
+		EngineCoordinates + FVector::XAxisVector * AxisLength,
+		EngineCoordinates + FVector::YAxisVector * AxisLength,
+		EngineCoordinates + FVector::ZAxisVector * AxisLength
+	};
+	FVector FixedPoints[4];
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		if (bRoundPlanet)
+		{
+			EngineToECEF(EnginePoints[Index], FixedPoints[Index]);
 		}
 		else
 		{
-			// We need to compute the ENU Vectors at the origin point. For that, the origin has to be expressed first in ECEF. 
-			// Express origin in ECEF, and get the ENU vectors
-			FVector ECEFOrigin;
-			Impl->WorldFrameToECEFFrame.SetIdentity();
-			if (bOriginLocationInProjectedCRS)
-			{
-				FVector ProjectedOrigin(
-					OriginProjectedCoordinatesEasting,
-					OriginProjectedCoordinatesNorthing,
-					OriginProjectedCoordinatesUp);
-				ProjectedToECEF(ProjectedOrigin, ECEFOrigin);
-
-				Impl->WorldFrameToECEFFrame = Impl->GetWorldFrameToECEFFrame(Impl->ProjectedEllipsoid, ECEFOrigin);
-			}
-			else
-			{
-				GeographicToECEF(FGeographicCoordinates(OriginLongitude, OriginLatitude, OriginAltitude), ECEFOrigin);
-				Impl->WorldFrameToECEFFrame = Impl->GetWorldFrameToECEFFrame(Impl->GeographicEllipsoid, ECEFOrigin);
-			}
-			Impl->ECEFFrameToWorldFrame = Impl->WorldFrameToECEFFrame.Inverse();
+			EngineToProjected(EnginePoints[Index], FixedPoints[Index]);
 		}
-		break;
+	}
 
-	case EPlanetShape::FlatPlanet:
-	default:
-		if (bOriginLocationInProjectedCRS)
+	const FVector PreviousGeographicOrigin(OriginLongitude, OriginLatitude, OriginAltitude);
+	const FVector PreviousProjectedOrigin(OriginProjectedCoordinatesEasting, OriginProjectedCoordinatesNorthing, OriginProjectedCoordinatesUp);
+	if (bOriginLocationInProjectedCRS)
+	{
+		FVector NewOrigin;
+		EngineToProjected(EngineCoordinates, NewOrigin);
+		OriginProjectedCoordinatesEasting = NewOrigin.X;
+		OriginProjectedCoordinatesNorthing = NewOrigin.Y;
+		OriginProjectedCoordinatesUp = NewOrigin.Z;
+	}
+	else
+	{
+		FGeographicCoordinates NewOrigin;
+		EngineToGeographic(EngineCoordinates, NewOrigin);
+		OriginLongitude = NewOrigin.Longitude;
+		OriginLatitude = NewOrigin.Latitude;
+		OriginAltitude = NewOrigin.Altitude;
+	}
+
+	// Nothing is changed when it fails
+	if (!ApplyOriginInternal())
+	{
+		OriginLongitude = PreviousGeographicOrigin.X;
+		OriginLatitude = PreviousGeographicOrigin.Y;
+		OriginAltitude = PreviousGeographicOrigin.Z;
+		OriginProjectedCoordinatesEasting = PreviousProjectedOrigin.X;
+		OriginProjectedCoordinatesNorthing = PreviousProjectedOrigin.Y;
+		OriginProjectedCoordinatesUp = PreviousProjectedOrigin.Z;
+		UE_LOG(LogGeoReferencing, Error, TEXT("Origin rebasing failed, the previous origin is restored"));
+		return false;
+	}
+
+	FVector NewPoints[4];
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		if (bRoundPlanet)
 		{
-			// World origin is expressed using Projected coordinates. Take them as is (in double)
-			Impl->WorldOriginLocationProjected = FVector(
-				OriginProjectedCoordinatesEasting,
-				OriginProjectedCoordinatesNorthing,
-				OriginProjectedCoordinatesUp);
+			ECEFToEngine(FixedPoints[Index], NewPoints[Index]);
 		}
 		else
 		{
-			// World origin is expressed using Geographic coordinates. Convert them to the projected CRS to have the offset
-			FVector OriginProjected;
-			GeographicToProjected(FGeographicCoordinates(OriginLongitude, OriginLatitude, OriginAltitude), OriginProjected);
-			Impl->WorldOriginLocationProjected = FVector(OriginProjected.X, OriginProjected.Y, OriginProjected.Z);
+			ProjectedToEngine(FixedPoints[Index], NewPoints[Index]);
 		}
-		break;
 	}
-	return;
+
+	FMatrix OldToNew(
+		(NewPoints[1] - NewPoints[0]).GetSafeNormal(),
+		(NewPoints[2] - NewPoints[0]).GetSafeNormal(),
+		(NewPoints[3] - NewPoints[0]).GetSafeNormal(),
+		FVector::ZeroVector);
+	OldToNew.SetOrigin(NewPoints[0] - OldToNew.TransformVector(EngineCoordinates));
+	OldToNewEngine = FTransform(OldToNew);
+
+	UE_LOG(LogGeoReferencing, Verbose, TEXT("Origin rebased at engine location %s, offset %s"), *EngineCoordinates.ToString(), *OldToNewEngine.GetTranslation().ToString());
+	OnOriginRebased.Broadcast(OldToNewEngine);
+	return true;
+}
+
+bool AGeoReferencingSystem::ShouldRebaseAtLocation(const FVector& EngineCoordinates)
+{
+	FCoordinatePrecision Precision = GetPrecisionAtLocation(EngineCoordinates);
+	return Precision.bRequiresRebasing;
+}
+
+void AGeoReferencingSystem::ProjectedToGeographic(const FVector& ProjectedCoordinates, FGeographicCoordinates& GeographicCoordinates)
+{
+	GEOREFERENCING_SCOPE(ProjectedToGeographic);
+	Impl->WaitForInitialization();
+
+	if (Impl->bNativeTransverseMercator)
+	{
+		GeographicCoordinates = Impl->TransverseMercator.ProjectedToGeographic(ProjectedCoordinates);
+		return;
+	}
+
+	PJ_COORD input, output;
+	input = proj_coord(ProjectedCoordinates.X, ProjectedCoordinates.Y, ProjectedCoordinates.Z, 0);
+
+	output = proj_trans(Impl->ProjProjectedToGeographic, PJ_FWD, input);
+	GeographicCoordinates.Latitude = output.lpz.phi;
+	GeographicCoordinates.Longitude = output.lpz.lam;
+	GeographicCoordinates.Altitude = output.lpz.z;
 }
 
-static void ProjLog(void* app_data, int level, const char* message)
+void AGeoReferencingSystem::GeographicToProjected(const FGeographicCoordinates& GeographicCoordinates, FVector& ProjectedCoordinates)
 {
-	FUTF8ToTCHAR Message (message);
-	switch (level)
+	GEOREFERENCING_SCOPE(GeographicToProjected);
+	Impl->WaitForInitialization();
+
+	if (Impl->bNativeTransverseMercator)
 	{
-	case PJ_LOG_ERROR:
-		UE_LOG(LogGeoReferencing, Error, TEXT("%s"), Message.Get());
-		break;
-	case PJ_LOG_DEBUG:
-		UE_LOG(LogGeoReferencing, Verbose, TEXT("%s"), Message.Get());
-		break;
-	case PJ_LOG_TRACE:
-		UE_LOG(LogGeoReferencing, VeryVerbose, TEXT("%s"), Message.Get());
-		break;
+		ProjectedCoordinates = Impl->TransverseMercator.GeographicToProjected(GeographicCoordinates);
+		return;
 	}
+
+	PJ_COORD input, output;
+	input = proj_coord(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude, GeographicCoordinates.Altitude, 0);
+
+	output = proj_trans(Impl->ProjProjectedToGeographic, PJ_INV, input);
+	ProjectedCoordinates.X = output.xyz.x;
+	ProjectedCoordinates.Y = output.xyz.y;
+	ProjectedCoordinates.Z = output.xyz.z;
 }
 
-void AGeoReferencingSystem::FGeoReferencingSystemInternals::InitPROJLibrary()
+void AGeoReferencingSystem::ProjectedToECEF(const FVector& ProjectedCoordinates, FVector& ECEFCoordinates)
 {
-	// Initialize proj context
-	ProjContext = proj_context_create();
-	if (ProjContext == nullptr)
+	GEOREFERENCING_SCOPE(ProjectedToECEF);
+	Impl->WaitForInitialization();
+
+	PJ_COORD input, output;
+	input = proj_coord(ProjectedCoordinates.X, ProjectedCoordinates.Y, ProjectedCoordinates.Z, 0);
+
+	output = proj_trans(Impl->ProjProjectedToECEF, PJ_FWD, input);
+	ECEFCoordinates.X = output.xyz.x;
+	ECEFCoordinates.Y = output.xyz.y;
+	ECEFCoordinates.Z = output.xyz.z;
+}
+
+void AGeoReferencingSystem::ECEFToProjected(const FVector& ECEFCoordinates, FVector& ProjectedCoordinates)
+{
+	GEOREFERENCING_SCOPE(ECEFToProjected);
+	Impl->WaitForInitialization();
+
+	PJ_COORD input, output;
+	input = proj_coord(ECEFCoordinates.X, ECEFCoordinates.Y, ECEFCoordinates.Z, 0);
+
+	output = proj_trans(Impl->ProjProjectedToECEF, PJ_INV, input);
+	ProjectedCoordinates.X = output.xyz.x;
+	ProjectedCoordinates.Y = output.xyz.y;
+	ProjectedCoordinates.Z = output.xyz.z;
+}
+
+void AGeoReferencingSystem::GeographicToECEF(const FGeographicCoordinates& GeographicCoordinates, FVector& ECEFCoordinates)
+{
+	GEOREFERENCING_SCOPE(GeographicToECEF);
+	Impl->WaitForInitialization();
+
+	if (Impl->bNativeGeographicToECEF)
+	{
+		ECEFCoordinates = Impl->GeographicEllipsoid.GeographicToECEF(GeographicCoordinates);
+		return;
+	}
+
+	PJ_COORD input, output;
+	input = proj_coord(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude, GeographicCoordinates.Altitude, 0);
+
+	output = proj_trans(Impl->ProjGeographicToECEF, PJ_FWD, input);
+	ECEFCoordinates.X = output.xyz.x;
+	ECEFCoordinates.Y = output.xyz.y;
+	ECEFCoordinates.Z = output.xyz.z;
+}
+
+void AGeoReferencingSystem::ECEFToGeographic(const FVector& ECEFCoordinates, FGeographicCoordinates& GeographicCoordinates)
+{
+	GEOREFERENCING_SCOPE(ECEFToGeographic);
+	Impl->WaitForInitialization();
+
+	if (Impl->bNativeGeographicToECEF)
+	{
+		GeographicCoordinates = Impl->GeographicEllipsoid.ECEFToGeographic(ECEFCoordinates);
+		return;
+	}
+
+	PJ_COORD input, output;
+	input = proj_coord(ECEFCoordinates.X, ECEFCoordinates.Y, ECEFCoordinates.Z, 0);
+
+	output = proj_trans(Impl->ProjGeographicToECEF, PJ_INV, input);
+	GeographicCoordinates.Latitude = output.lpz.phi;
+	GeographicCoordinates.Longitude = output.lpz.lam;
+	GeographicCoordinates.Altitude = output.lpz.z;
+}
+
+// ENU & Transforms
+
+void AGeoReferencingSystem::GetENUVectorsAtEngineLocation(const FVector& EngineCoordinates, FVector& East, FVector& North, FVector& Up)
+{
+	FVector ECEFLocation;
+	EngineToECEF(EngineCoordinates, ECEFLocation);
+	GetENUVectorsAtECEFLocation(ECEFLocation, East, North, Up);
+}
+
+void AGeoReferencingSystem::GetENUVectorsAtProjectedLocation(const FVector& ProjectedCoordinates, FVector& East, FVector& North, FVector& Up)
+{
+	FVector ECEFLocation;
+	ProjectedToECEF(ProjectedCoordinates, ECEFLocation);
+	GetENUVectorsAtECEFLocation(ECEFLocation, East, North, Up);
+}
+
+void AGeoReferencingSystem::GetENUVectorsAtGeographicLocation(const FGeographicCoordinates& GeographicCoordinates, FVector& East, FVector& North, FVector& Up)
+{
+	// The analytic FlatPlanet vectors only need the geographic location, skip the roundtrip to ECEF
+	if (PlanetShape == EPlanetShape::FlatPlanet && GetFlatPlanetENUVectors(GeographicCoordinates, East, North, Up))
 	{
-		UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_create() failed"));
 		return;
 	}
 
-	// Connect PROJ logging
-	proj_log_func(ProjContext, nullptr, ProjLog);
-	proj_log_level(ProjContext, PJ_LOG_TRACE);
+	FVector ECEFLocation;
+	GeographicToECEF(GeographicCoordinates, ECEFLocation);
+	GetENUVectorsAtECEFLocation(ECEFLocation, East, North, Up);
+}
+
+void AGeoReferencingSystem::GetENUVectorsAtECEFLocation(const FVector& ECEFCoordinates, FVector& East, FVector& North, FVector& Up)
+{
+	Impl->WaitForInitialization();
+
+	// Compute Tangent matrix at ECEF location
+	const FEllipsoid& Ellipsoid = bOriginLocationInProjectedCRS ? Impl->ProjectedEllipsoid : Impl->GeographicEllipsoid;
+
+	switch (PlanetShape)
+	{
+	case EPlanetShape::RoundPlanet:
+	{
+		FMatrix WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
+		FMatrix UEtoECEF = WorldFrameToECEFFrameAtLocation * Impl->ECEFFrameToWorldFrame * Impl->UEFrameToWorldFrame;
+		UEtoECEF.GetUnitAxes(East, North, Up);
+	}
+	break;
+
+	case EPlanetShape::FlatPlanet:
+	default:
+	{
+		FGeographicCoordinates GeographicCoordinates;
+		ECEFToGeographic(ECEFCoordinates, GeographicCoordinates);
+		if (GetFlatPlanetENUVectors(GeographicCoordinates, East, North, Up))
+		{
+			break;
+		}
+
+		// No projection factors for this CRS. PROJ don't provide anything to project direction vectors. Let's do it by hand...
+		FMatrix WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
+		FVector EasternPoint = ECEFCoordinates + WorldFrameToECEFFrameAtLocation.TransformVector(FVector(1.0, 0.0, 0.0)); // 1m from origin to the East
+		FVector NorthernPoint = ECEFCoordinates + WorldFrameToECEFFrameAtLocation.TransformVector(FVector(0.0, 1.0, 0.0)); // 1m from origin to the North
+		
+		FVector ProjectedOrigin, ProjectedEastern, ProjectedNorthern;
+		ECEFToProjected(ECEFCoordinates, ProjectedOrigin);
+		ECEFToProjected(EasternPoint, ProjectedEastern);
+		ECEFToProjected(NorthernPoint, ProjectedNorthern);
+
+		FVector EastDirection(ProjectedEastern.X - ProjectedOrigin.X, ProjectedEastern.Y - ProjectedOrigin.Y, ProjectedEastern.Z - ProjectedOrigin.Z);
+		FVector NorthDirection(ProjectedNorthern.X - ProjectedOrigin.X, ProjectedNorthern.Y - ProjectedOrigin.Y, ProjectedNorthern.Z - ProjectedOrigin.Z);
+
+		EastDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
+		NorthDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
+
+		East = FVector(EastDirection.X, -EastDirection.Y, EastDirection.Z);
+		North = FVector(NorthDirection.X, -NorthDirection.Y, NorthDirection.Z);
+		Up = FVector::CrossProduct(North, East);
+	}
+	break;
+	}
+}
+
+// proj_factors on a projected CRS, null if the CRS is not a projection
+static bool ComputePROJFactors(PJ* ProjectedCRSPJ, const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors)
+{
+	if (ProjectedCRSPJ == nullptr)
+	{
+		return false;
+	}
+
+	// Longitude and latitude in radians, on the base geographic CRS of the projection. The datum shift to GeographicCRS, if any, has no visible effect on the factors.
+	const PJ_COORD Input = proj_coord(FMath::DegreesToRadians(GeographicCoordinates.Longitude), FMath::DegreesToRadians(GeographicCoordinates.Latitude), 0.0, 0.0);
+	const PJ_FACTORS ProjFactors = proj_factors(ProjectedCRSPJ, Input);
+	if (proj_errno(ProjectedCRSPJ) != 0)
+	{
+		proj_errno_reset(ProjectedCRSPJ);
+		return false;
+	}
+
+	Factors.MeridianConvergence = FMath::RadiansToDegrees(ProjFactors.meridian_convergence);
+	Factors.MeridionalScale = ProjFactors.meridional_scale;
+	Factors.ParallelScale = ProjFactors.parallel_scale;
+	Factors.ArealScale = ProjFactors.areal_scale;
+	Factors.AngularDistortion = FMath::RadiansToDegrees(ProjFactors.angular_distortion);
+	Factors.MeridianParallelAngle = FMath::RadiansToDegrees(ProjFactors.meridian_parallel_angle);
+	Factors.DxDLambda = ProjFactors.dx_dlam;
+	Factors.DxDPhi = ProjFactors.dx_dphi;
+	Factors.DyDLambda = ProjFactors.dy_dlam;
+	Factors.DyDPhi = ProjFactors.dy_dphi;
+	return true;
+}
+
+// Engine frame East, North and Up of a flat planet, from the projection factors
+static bool ProjectionFactorsToENUVectors(const FGeoProjectionFactors& Factors, FVector& East, FVector& North, FVector& Up)
+{
+	// East and North are the projections of the parallel and the meridian : the derivatives along longitude and latitude.
+	// Undefined at the poles, where the parallel shrinks to a point.
+	FVector EastDirection(Factors.DxDLambda, Factors.DyDLambda, 0.0);
+	FVector NorthDirection(Factors.DxDPhi, Factors.DyDPhi, 0.0);
+	if (!EastDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER) || !NorthDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER))
+	{
+		return false;
+	}
+
+	East = FVector(EastDirection.X, -EastDirection.Y, 0.0);
+	North = FVector(NorthDirection.X, -NorthDirection.Y, 0.0);
+	Up = FVector::CrossProduct(North, East);
+	return true;
+}
+
+bool AGeoReferencingSystem::ComputeProjectionFactors(const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors) const
+{
+	Impl->WaitForInitialization();
+
+	return ComputePROJFactors(Impl->ProjProjectedCRS, GeographicCoordinates, Factors);
+}
+
+bool AGeoReferencingSystem::GetProjectionFactors(const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors)
+{
+	Impl->WaitForInitialization();
+
+	return Impl->GetProjectionFactors(Impl->ProjProjectedCRS, GeographicCoordinates, Factors);
+}
+
+bool AGeoReferencingSystem::FGeoReferencingSystemInternals::GetProjectionFactors(PJ* ProjectedCRS, const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors)
+{
+	FGeoProjectionFactorsCache& Cache = ProjectionFactorsCache;
+	if (!Cache.IsEnabled())
+	{
+		return ComputePROJFactors(ProjectedCRS, GeographicCoordinates, Factors);
+	}
+
+	int64 CellX, CellY;
+	FGeographicCoordinates CellCenter;
+	Cache.GetCell(GeographicCoordinates, CellX, CellY, CellCenter);
+	uint32 CacheGeneration = 0;
+	if (Cache.Find(CellX, CellY, Factors, CacheGeneration))
+	{
+		return true;
+	}
+
+	if (!ComputePROJFactors(ProjectedCRS, CellCenter, Factors))
+	{
+		// The cell center may fall outside the domain (poles, zone edges) where the location itself does not
+		return ComputePROJFactors(ProjectedCRS, GeographicCoordinates, Factors);
+	}
+	Cache.Add(CellX, CellY, Factors, CacheGeneration);
+	return true;
+}
+
+bool AGeoReferencingSystem::GetFlatPlanetENUVectors(const FGeographicCoordinates& GeographicCoordinates, FVector& East, FVector& North, FVector& Up)
+{
+	FGeoProjectionFactors Factors;
+	return GetProjectionFactors(GeographicCoordinates, Factors) && ProjectionFactorsToENUVectors(Factors, East, North, Up);
+}
+
+bool AGeoReferencingSystem::GetProjectionFactorsBatch(const TArray<FGeographicCoordinates>& GeographicCoordinates, TArray<FGeoProjectionFactors>& Factors)
+{
+	Factors.Reset(GeographicCoordinates.Num());
+	Factors.AddDefaulted(GeographicCoordinates.Num());
+
+	bool bSuccess = true;
+	for (int32 Index = 0; Index < GeographicCoordinates.Num(); ++Index)
+	{
+		if (!ComputeProjectionFactors(GeographicCoordinates[Index], Factors[Index]))
+		{
+			Factors[Index] = FGeoProjectionFactors();
+			bSuccess = false;
+		}
+	}
+	return bSuccess;
+}
+
+void AGeoReferencingSystem::GetECEFENUVectorsAtECEFLocation(const FVector& ECEFCoordinates, FVector& ECEFEast, FVector& ECEFNorth, FVector& ECEFUp)
+{
+	Impl->WaitForInitialization();
+
+	// Compute Tangent matrix at ECEF location
+	const FEllipsoid& Ellipsoid = bOriginLocationInProjectedCRS ? Impl->ProjectedEllipsoid : Impl->GeographicEllipsoid;
+	
+	FMatrix WorldFrameToECEFFrameAtLocation;
+	WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
+	WorldFrameToECEFFrameAtLocation.GetUnitAxes(ECEFEast, ECEFNorth, ECEFUp);
+}
+
+FTransform AGeoReferencingSystem::GetTangentTransformAtEngineLocation(const FVector& EngineCoordinates)
+{
+	FVector ECEFLocation;
+	EngineToECEF(EngineCoordinates, ECEFLocation);
+	return GetTangentTransformAtECEFLocation(ECEFLocation);
+}
+
+FTransform AGeoReferencingSystem::GetTangentTransformAtProjectedLocation(const FVector& ProjectedCoordinates)
+{
+	FVector ECEFLocation;
+	ProjectedToECEF(ProjectedCoordinates, ECEFLocation);
+	return GetTangentTransformAtECEFLocation(ECEFLocation);
+}
+
+FTransform AGeoReferencingSystem::GetTangentTransformAtGeographicLocation(const FGeographicCoordinates& GeographicCoordinates)
+{
+	FVector ECEFLocation;
+	GeographicToECEF(GeographicCoordinates, ECEFLocation);
+	return GetTangentTransformAtECEFLocation(ECEFLocation);
+}
+
+FTransform AGeoReferencingSystem::GetTangentTransformAtECEFLocation(const FVector& ECEFCoordinates)
+{
+	Impl->WaitForInitialization();
+
+	if (PlanetShape == EPlanetShape::RoundPlanet)
+	{
+		// Compute Tangent matrix at ECEF location
+		const FEllipsoid& Ellipsoid = bOriginLocationInProjectedCRS ? Impl->ProjectedEllipsoid : Impl->GeographicEllipsoid;
+		FMatrix WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, ECEFCoordinates);
+		
+
+		FMatrix UEtoECEF = Impl->UEFrameToWorldFrame * WorldFrameToECEFFrameAtLocation * Impl->ECEFFrameToWorldFrame * Impl->WorldFrameToUEFrame; 
+		FVector UEOrigin;
+		ECEFToEngine(ECEFCoordinates, UEOrigin);
+		UEtoECEF.SetOrigin(UEOrigin);
+
+		return FTransform(UEtoECEF);
+	}
+	else
+	{
+		FVector East, North, Up, UEOrigin;
+		GetENUVectorsAtECEFLocation(ECEFCoordinates, East, North, Up);
+		ECEFToEngine(ECEFCoordinates, UEOrigin);
+		FMatrix TransformMatrix(East, North, Up, UEOrigin);
+		return FTransform(TransformMatrix);
+	}
+}
+
+// Batch Tangent Transforms
+
+void AGeoReferencingSystem::ComputeTangentMatrices(EGeoConversion LocationToECEF, const FGeoCoordinateStreams& Locations, TFunctionRef<void(int32 StartIndex, TConstArrayView<FMatrix> Matrices)> OutputChunk)
+{
+	GEOREFERENCING_SCOPE(BatchTransform);
+	Impl->WaitForInitialization();
+
+	if (Locations.Num <= 0)
+	{
+		return;
+	}
+
+	// Track performance
+	double StartTime = FPlatformTime::Seconds();
+
+	const FEllipsoid& Ellipsoid = bOriginLocationInProjectedCRS ? Impl->ProjectedEllipsoid : Impl->GeographicEllipsoid;
+	const bool bRoundPlanet = PlanetShape == EPlanetShape::RoundPlanet;
+
+	// UEFrameToWorldFrame * WorldFrameToECEFFrame(Location) * ECEFFrameToWorldFrame * WorldFrameToUEFrame : the right hand product doesn't depend on the location.
+	// The translations end up in the origin, which is replaced by the engine location, only the rotation is kept.
+	FMatrix ECEFToUERotation = Impl->ECEFFrameToWorldFrame * Impl->WorldFrameToUEFrame;
+	ECEFToUERotation.SetOrigin(FVector::ZeroVector);
+
+	// Geographic locations on the ellipsoid used for the frames give the ECEF location and the frame from the same trigonometry
+	const bool bTrigonometricFrames = bRoundPlanet && LocationToECEF == EGeoConversion::GeographicToECEF && Impl->bNativeGeographicToECEF && Ellipsoid.Radii == Impl->GeographicEllipsoid.Radii;
+
+	// PROJ objects can't be shared between threads : one context per worker, each worker converting whole chunks
+	const int32 NumChunks = FMath::DivideAndRoundUp(Locations.Num, GeoReferencingBatchChunkSize);
+	int32 NumWorkers = FMath::Min(NumChunks, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+	TArray<TUniquePtr<FProjWorkerContext>> WorkerContexts;
+	if (NumWorkers > 1 && !Impl->AcquireWorkerContexts(NumWorkers, WorkerContexts))
+	{
+		UE_LOG(LogGeoReferencing, Warning, TEXT("ComputeTangentMatrices could not create the PROJ worker contexts, falling back to single-threaded batch"));
+		NumWorkers = 1;
+	}
+
+	ParallelFor(NumWorkers, [&](int32 WorkerIndex)
+	{
+		const FProjPipelines Pipelines = WorkerContexts.Num() > 0 ? WorkerContexts[WorkerIndex]->Pipelines : Impl->GetPipelines();
+		PJ* ProjectedCRS = WorkerContexts.Num() > 0 ? WorkerContexts[WorkerIndex]->ProjectedCRS : Impl->ProjProjectedCRS;
+
+		// Scratch : ECEF locations, then their geographic coordinates for flat planets
+		TArray<FVector> Points;
+		TArray<FMatrix> Matrices;
+		Points.SetNumUninitialized(2 * GeoReferencingBatchChunkSize);
+		Matrices.SetNumUninitialized(GeoReferencingBatchChunkSize);
+
+		for (int32 ChunkIndex = WorkerIndex; ChunkIndex < NumChunks; ChunkIndex += NumWorkers)
+		{
+			const int32 StartIndex = ChunkIndex * GeoReferencingBatchChunkSize;
+			const int32 Num = FMath::Min(GeoReferencingBatchChunkSize, Locations.Num - StartIndex);
+
+			TArrayView<FVector> Locations3D = MakeArrayView(Points.GetData(), Num);
+			const FGeoCoordinateStreams LocationStreams = FGeoCoordinateStreams::Make(Locations3D);
+
+			// ECEF locations, and the frames if they come with them
+			FVector East, North, Up;
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Locations3D[i] = Locations.GetVector(StartIndex + i);
+			}
+			if (bTrigonometricFrames)
+			{
+				for (int32 i = 0; i < Num; ++i)
+				{
+					Locations3D[i] = Impl->GeographicEllipsoid.GeographicToECEFWithENU(FGeographicCoordinates(Locations3D[i].X, Locations3D[i].Y, Locations3D[i].Z), East, North, Up);
+					Matrices[i] = FMatrix(East, North, Up, FVector::ZeroVector);
+				}
+			}
+			else if (LocationToECEF != EGeoConversion::Count)
+			{
+				TransformStreams(LocationToECEF, Pipelines, LocationStreams);
+			}
+
+			if (bRoundPlanet)
+			{
+				for (int32 i = 0; i < Num; ++i)
+				{
+					// Points on the planet axis get the conventional frame of GetWorldFrameToECEFFrame()
+					if (!bTrigonometricFrames || (FMathd::Abs(Locations3D[i].X) < FMathd::Epsilon && FMathd::Abs(Locations3D[i].Y) < FMathd::Epsilon))
+					{
+						Matrices[i] = Impl->GetWorldFrameToECEFFrame(Ellipsoid, Locations3D[i]);
+					}
+					Matrices[i].GetScaledAxes(East, North, Up);
+					Matrices[i] = FMatrix(ECEFToUERotation.TransformVector(East), -ECEFToUERotation.TransformVector(North), ECEFToUERotation.TransformVector(Up), FVector::ZeroVector);
+				}
+				TransformStreams(EGeoConversion::ECEFToEngine, Pipelines, LocationStreams);
+			}
+			else
+			{
+				// Directions from the projection factors, as in GetENUVectorsAtECEFLocation()
+				TArrayView<FVector> GeographicLocations = MakeArrayView(Points.GetData() + Num, Num);
+				FMemory::Memcpy(GeographicLocations.GetData(), Locations3D.GetData(), Num * sizeof(FVector));
+				TransformStreams(EGeoConversion::ECEFToGeographic, Pipelines, FGeoCoordinateStreams::Make(GeographicLocations));
+
+				for (int32 i = 0; i < Num; ++i)
+				{
+					FGeoProjectionFactors Factors;
+					const FGeographicCoordinates GeographicCoordinates(GeographicLocations[i].X, GeographicLocations[i].Y, GeographicLocations[i].Z);
+					if (!Impl->GetProjectionFactors(ProjectedCRS, GeographicCoordinates, Factors) || !ProjectionFactorsToENUVectors(Factors, East, North, Up))
+					{
+						// No projection factors here. Project the points 1 m to the East and to the North by hand.
+						const FMatrix WorldFrameToECEFFrameAtLocation = Impl->GetWorldFrameToECEFFrame(Ellipsoid, Locations3D[i]);
+						FVector ProjectedPoints[3] = { Locations3D[i], Locations3D[i] + WorldFrameToECEFFrameAtLocation.GetScaledAxis(EAxis::X), Locations3D[i] + WorldFrameToECEFFrameAtLocation.GetScaledAxis(EAxis::Y) };
+						TransformStreams(EGeoConversion::ECEFToProjected, Pipelines, FGeoCoordinateStreams::Make(MakeArrayView(ProjectedPoints)));
+
+						FVector EastDirection = ProjectedPoints[1] - ProjectedPoints[0];
+						FVector NorthDirection = ProjectedPoints[2] - ProjectedPoints[0];
+						EastDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
+						NorthDirection.Normalize(GEOREF_DOUBLE_SMALL_NUMBER);
+
+						East = FVector(EastDirection.X, -EastDirection.Y, EastDirection.Z);
+						North = FVector(NorthDirection.X, -NorthDirection.Y, NorthDirection.Z);
+						Up = FVector::CrossProduct(North, East);
+					}
+					Matrices[i] = FMatrix(East, North, Up, FVector::ZeroVector);
+				}
+				TransformStreams(EGeoConversion::ProjectedToEngine, Pipelines, LocationStreams);
+			}
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Matrices[i].SetOrigin(Locations3D[i]);
+			}
+			OutputChunk(StartIndex, MakeArrayView(Matrices.GetData(), Num));
+		}
+	}, WorkerContexts.Num() > 0 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	Impl->ReleaseWorkerContexts(WorkerContexts);
+
+	// Update performance stats, in their own histogram : a frame costs more than a conversion, they would skew the conversion latencies
+	const double ElapsedMicroseconds = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+	Impl->TangentFramesLatencyHistogram.Record(static_cast<uint64>(FMath::Max(ElapsedMicroseconds, 0.0) * 1000.0), Locations.Num);
+}
+
+// Locations are only read, the const views are made mutable to share the streams code
+template<typename ElementType>
+static FGeoCoordinateStreams MakeReadOnlyStreams(TConstArrayView<ElementType> Locations)
+{
+	return FGeoCoordinateStreams::Make(MakeArrayView(const_cast<ElementType*>(Locations.GetData()), Locations.Num()));
+}
+
+static void WriteTangentMatrices(TArrayView<FMatrix> Output, int32 StartIndex, TConstArrayView<FMatrix> Matrices)
+{
+	FMemory::Memcpy(Output.GetData() + StartIndex, Matrices.GetData(), Matrices.Num() * sizeof(FMatrix));
+}
+
+static void WriteTangentTransforms(TArrayView<FTransform> Output, int32 StartIndex, TConstArrayView<FMatrix> Matrices)
+{
+	for (int32 i = 0; i < Matrices.Num(); ++i)
+	{
+		Output[StartIndex + i] = FTransform(Matrices[i]);
+	}
+}
+
+void AGeoReferencingSystem::GetTangentTransformsAtGeographicLocations(const TArray<FGeographicCoordinates>& GeographicCoordinates, TArray<FTransform>& Transforms)
+{
+	Transforms.SetNumUninitialized(GeographicCoordinates.Num());
+	GetTangentTransformsAtGeographicLocations(MakeArrayView(GeographicCoordinates), MakeArrayView(Transforms));
+}
+
+void AGeoReferencingSystem::GetTangentTransformsAtEngineLocations(const TArray<FVector>& EngineCoordinates, TArray<FTransform>& Transforms)
+{
+	Transforms.SetNumUninitialized(EngineCoordinates.Num());
+	GetTangentTransformsAtEngineLocations(MakeArrayView(EngineCoordinates), MakeArrayView(Transforms));
+}
+
+void AGeoReferencingSystem::GetTangentTransformsAtGeographicLocations(TConstArrayView<FGeographicCoordinates> GeographicCoordinates, TArrayView<FTransform> Transforms)
+{
+	check(GeographicCoordinates.Num() == Transforms.Num());
+	ComputeTangentMatrices(EGeoConversion::GeographicToECEF, MakeReadOnlyStreams(GeographicCoordinates), [Transforms](int32 StartIndex, TConstArrayView<FMatrix> Matrices) { WriteTangentTransforms(Transforms, StartIndex, Matrices); });
+}
+
+void AGeoReferencingSystem::GetTangentTransformsAtEngineLocations(TConstArrayView<FVector> EngineCoordinates, TArrayView<FTransform> Transforms)
+{
+	check(EngineCoordinates.Num() == Transforms.Num());
+	ComputeTangentMatrices(EGeoConversion::EngineToECEF, MakeReadOnlyStreams(EngineCoordinates), [Transforms](int32 StartIndex, TConstArrayView<FMatrix> Matrices) { WriteTangentTransforms(Transforms, StartIndex, Matrices); });
+}
+
+void AGeoReferencingSystem::GetTangentTransformsAtProjectedLocations(TConstArrayView<FVector> ProjectedCoordinates, TArrayView<FTransform> Transforms)
+{
+	check(ProjectedCoordinates.Num() == Transforms.Num());
+	ComputeTangentMatrices(EGeoConversion::ProjectedToECEF, MakeReadOnlyStreams(ProjectedCoordinates), [Transforms](int32 StartIndex, TConstArrayView<FMatrix> Matrices) { WriteTangentTransforms(Transforms, StartIndex, Matrices); });
+}
+
+void AGeoReferencingSystem::GetTangentTransformsAtECEFLocations(TConstArrayView<FVector> ECEFCoordinates, TArrayView<FTransform> Transforms)
+{
+	check(ECEFCoordinates.Num() == Transforms.Num());
+	ComputeTangentMatrices(EGeoConversion::Count, MakeReadOnlyStreams(ECEFCoordinates), [Transforms](int32 StartIndex, TConstArrayView<FMatrix> Matrices) { WriteTangentTransforms(Transforms, StartIndex, Matrices); });
+}
+
+void AGeoReferencingSystem::GetTangentMatricesAtGeographicLocations(TConstArrayView<FGeographicCoordinates> GeographicCoordinates, TArrayView<FMatrix> Matrices)
+{
+	check(GeographicCoordinates.Num() == Matrices.Num());
+	ComputeTangentMatrices(EGeoConversion::GeographicToECEF, MakeReadOnlyStreams(GeographicCoordinates), [Matrices](int32 StartIndex, TConstArrayView<FMatrix> Chunk) { WriteTangentMatrices(Matrices, StartIndex, Chunk); });
+}
+
+void AGeoReferencingSystem::GetTangentMatricesAtEngineLocations(TConstArrayView<FVector> EngineCoordinates, TArrayView<FMatrix> Matrices)
+{
+	check(EngineCoordinates.Num() == Matrices.Num());
+	ComputeTangentMatrices(EGeoConversion::EngineToECEF, MakeReadOnlyStreams(EngineCoordinates), [Matrices](int32 StartIndex, TConstArrayView<FMatrix> Chunk) { WriteTangentMatrices(Matrices, StartIndex, Chunk); });
+}
+
+void AGeoReferencingSystem::GetTangentMatricesAtProjectedLocations(TConstArrayView<FVector> ProjectedCoordinates, TArrayView<FMatrix> Matrices)
+{
+	check(ProjectedCoordinates.Num() == Matrices.Num());
+	ComputeTangentMatrices(EGeoConversion::ProjectedToECEF, MakeReadOnlyStreams(ProjectedCoordinates), [Matrices](int32 StartIndex, TConstArrayView<FMatrix> Chunk) { WriteTangentMatrices(Matrices, StartIndex, Chunk); });
+}
+
+void AGeoReferencingSystem::GetTangentMatricesAtECEFLocations(TConstArrayView<FVector> ECEFCoordinates, TArrayView<FMatrix> Matrices)
+{
+	check(ECEFCoordinates.Num() == Matrices.Num());
+	ComputeTangentMatrices(EGeoConversion::Count, MakeReadOnlyStreams(ECEFCoordinates), [Matrices](int32 StartIndex, TConstArrayView<FMatrix> Chunk) { WriteTangentMatrices(Matrices, StartIndex, Chunk); });
+}
+
+FTransform AGeoReferencingSystem::GetPlanetCenterTransform()
+{
+	Impl->WaitForInitialization();
+
+	// Compute Origin location in ECEF. 
+	if (PlanetShape == EPlanetShape::RoundPlanet)
+	{
+		if (bOriginAtPlanetCenter)
+		{
+			return FTransform::Identity;
+		}
+		else
+		{
+			FMatrix TransformMatrix = Impl->UEFrameToWorldFrame * Impl->ECEFFrameToWorldFrame * Impl->WorldFrameToUEFrame;
+			// Don't go to transform yet, we must stay in double to apply the rebasing offset. 
+
+			// Get Origin, and convert UE units to meters, invert the Y coordinate because of left-handed UE Frame
+			FVector UEOrigin = TransformMatrix.GetOrigin() * FVector(100.0, 100.0, 100.0);
+			TransformMatrix.SetOrigin(UEOrigin);
+
+			return FTransform(TransformMatrix);
+		}
+	}
+	else
+	{
+		// Makes not sense in Flat planet mode... 
+		return FTransform::Identity;
+	}
+}
+
+// Public PROJ Utilities
+
+bool AGeoReferencingSystem::IsCRSStringValid(FString CRSString, FString& Error)
+{
+	Impl->WaitForInitialization();
+
+	if (Impl->ProjContext == nullptr)
+	{
+		Error = FString("Proj Context has not been initialized");
+		return false;
+	}
+
+	// Try to create a CRS from this string
+	FTCHARToUTF8 Convert(*CRSString);
+	const ANSICHAR* UtfString = Convert.Get();
+	GEOREFERENCING_COUNTER_ADD(ProjDatabaseQueries, 1);
+	PJ* CRS = proj_create(Impl->ProjContext, UtfString);
+
+	if (CRS == nullptr)
+	{
+		int ErrorNumber = proj_context_errno(Impl->ProjContext);
+		Error = FString(proj_errno_string(ErrorNumber));
+		return false;
+	}
+
+	proj_destroy(CRS);
+	return true;
+}
+
+// Ellipsoid
+
+double AGeoReferencingSystem::GetGeographicEllipsoidMaxRadius()
+{
+	Impl->WaitForInitialization();
+	return Impl->GeographicEllipsoid.GetMaximumRadius();
+}
+
+double AGeoReferencingSystem::GetGeographicEllipsoidMinRadius()
+{
+	Impl->WaitForInitialization();
+	return Impl->GeographicEllipsoid.GetMinimumRadius();
+}
+
+double AGeoReferencingSystem::GetProjectedEllipsoidMaxRadius()
+{
+	Impl->WaitForInitialization();
+	return Impl->ProjectedEllipsoid.GetMaximumRadius();
+}
+
+double AGeoReferencingSystem::GetProjectedEllipsoidMinRadius()
+{
+	Impl->WaitForInitialization();
+	return Impl->ProjectedEllipsoid.GetMinimumRadius();
+}
+
+bool AGeoReferencingSystem::FGeoReferencingSystemInternals::GetEllipsoid(FString CRSString, FEllipsoid& Ellipsoid)
+{
+	GEOREFERENCING_SCOPE(GetEllipsoid);
+
+	FTCHARToUTF8 ConvertCRSString(*CRSString);
+	const ANSICHAR* CRS = ConvertCRSString.Get();
+	bool bSuccess = true;
+
+	GEOREFERENCING_COUNTER_ADD(ProjDatabaseQueries, 1);
+	PJ* CRSPJ = proj_create(ProjContext, CRS);
+	if (CRSPJ != nullptr)
+	{
+		PJ* EllipsoidPJ = proj_get_ellipsoid(ProjContext, CRSPJ);
+		if (EllipsoidPJ != nullptr)
+		{
+			double SemiMajorMetre; // semi-major axis in meter
+			double SemiMinorMetre; // semi-minor axis in meter
+			double InvFlattening;  // inverse flattening.
+			int IsSemiMinorComputed; // if the semi-minor value was computed. If FALSE, its value comes from the definition
+
+			if (proj_ellipsoid_get_parameters(ProjContext, EllipsoidPJ, &SemiMajorMetre, &SemiMinorMetre, &IsSemiMinorComputed, &InvFlattening))
+			{
+				Ellipsoid = FEllipsoid(SemiMajorMetre, SemiMajorMetre, SemiMinorMetre);
+			}
+			else
+			{
+				int ErrorNumber = proj_context_errno(ProjContext);
+				FString ProjError = FString(proj_errno_string(ErrorNumber));
+				UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::GetEllipsoid failed in proj_ellipsoid_get_parameters : %s "), *ProjError);
+				bSuccess = false;
+			}
+
+			proj_destroy(EllipsoidPJ);
+		}
+		else
+		{
+			int ErrorNumber = proj_context_errno(ProjContext);
+			FString ProjError = FString(proj_errno_string(ErrorNumber));
+			UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::GetEllipsoid failed in proj_get_ellipsoid : %s "), *ProjError);
+			bSuccess = false;
+		}
+
+		proj_destroy(CRSPJ);
+	}
+	else
+	{
+		int ErrorNumber = proj_context_errno(ProjContext);
+		FString ProjError = FString(proj_errno_string(ErrorNumber));
+		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::GetEllipsoid failed in proj_create : %s "), *ProjError);
+		UE_LOG(LogGeoReferencing, Display, TEXT("CRSString was : %s "), *CRSString);
+		bSuccess = false;
+	}
+
+	return bSuccess;
+}
+
+void AGeoReferencingSystem::ApplySettings()
+{
+	// A pending asynchronous initialization is applying the settings too
+	Impl->WaitForInitialization();
+
+	const bool bSuccess = ApplySettingsInternal(CaptureSettings());
+#if WITH_EDITOR
+	if (!bSuccess)
+	{
+		NotifyCRSError();
+	}
+#endif
+}
+
+#if WITH_EDITOR
+void AGeoReferencingSystem::NotifyCRSError()
+{
+	// Show an error notification
+	const FText NotificationErrorText = NSLOCTEXT("GeoReferencing", "GeoReferencingCRSError", "Error in one CRS definition string - Check log");
+	FNotificationInfo Info(NotificationErrorText);
+	Info.ExpireDuration = 2.0f;
+	Info.bUseSuccessFailIcons = true;
+	FSlateNotificationManager::Get().AddNotification(Info);
+}
+#endif
+
+bool AGeoReferencingSystem::ApplySettingsInternal(const FAppliedSettings& Settings)
+{
+	GEOREFERENCING_SCOPE(ApplySettings);
+
+	// Running batches read the transforms we are about to change
+	Impl->CancelAsyncBatches();
+	Impl->WaitForAsyncBatches();
+
+	// Worker contexts hold clones of the pipelines we are about to replace
+	Impl->InvalidateWorkerContexts();
+
+	// Cached results are only valid for the previous settings
+	const int32 CoordinateCacheSizeToApply = Settings.bUseCoordinateCache ? Settings.CoordinateCacheSize : 0;
+	if (CoordinateCacheSizeToApply != Impl->CoordinateCacheSizeApplied)
+	{
+		Impl->CoordinateCache.Configure(CoordinateCacheSizeToApply);
+		Impl->CoordinateCacheSizeApplied = CoordinateCacheSizeToApply;
+	}
+	Impl->CoordinateCache.Invalidate();
+	{
+		FScopeLock Lock(&Impl->ApproximateTransformerMutex);
+		Impl->ApproximateTransformer.Reset();
+	}
+	Impl->ProjectionFactorsCache.Configure(Settings.bUseProjectionFactorsCache ? Settings.ProjectionFactorsCacheCellSize : 0.0);
+
+	// Apply Projection settings, from the state resolved at cook time if there is one for these settings
+	const bool bFromCookedState = ApplyCookedState(Settings);
+	const bool bSuccess = bFromCookedState || ApplyProjectionSettings(Settings);
+
+#if WITH_EDITOR
+	if (!bSuccess)
+	{
+		// The caller notifies the user, from the game thread
+		return false;
+	}
+#endif
+
+	ApplyOriginSettings(Settings, bFromCookedState);
+
+	Impl->SelectStreamKernels(Settings.PlanetShape == EPlanetShape::RoundPlanet);
+	Impl->BuildLocalFrameGrid(Settings);
+	Impl->BuildSourceWorkerContext();
+	Impl->PublishSnapshot(Settings.PlanetShape, Settings.ProjectedCRS, Settings.GeographicCRS, false);
+
+	// Conversions and factors cached while the settings were applied may mix the previous transforms and the new ones
+	Impl->CoordinateCache.Invalidate();
+	Impl->ProjectionFactorsCache.Invalidate();
+	return bSuccess;
+}
+
+void AGeoReferencingSystem::ApplyOriginSettings(const FAppliedSettings& Settings, bool bFromCookedState)
+{
+	switch (Settings.PlanetShape)
+	{
+	case EPlanetShape::RoundPlanet:
+		// Matrice UE to ECEF :
+		if (bFromCookedState)
+		{
+			Impl->WorldFrameToECEFFrame = CookedState.WorldFrameToECEFFrame;
+			Impl->ECEFFrameToWorldFrame = Impl->WorldFrameToECEFFrame.Inverse();
+		}
+		else if (Settings.bOriginAtPlanetCenter)
+		{
+			// Theoritically, we should never use this Identity matrices since the transformations already handle that using a shorter code path, but let's keep consistency  
+			Impl->ECEFFrameToWorldFrame.SetIdentity();
+			Impl->WorldFrameToECEFFrame.SetIdentity();
+		}
+		else
+		{
+			// We need to compute the ENU Vectors at the origin point. For that, the origin has to be expressed first in ECEF. 
+			// Express origin in ECEF, and get the ENU vectors
+			FVector ECEFOrigin;
+			Impl->WorldFrameToECEFFrame.SetIdentity();
+			if (Settings.bOriginLocationInProjectedCRS)
+			{
+				FVector ProjectedOrigin(
+					Settings.OriginProjectedCoordinatesEasting,
+					Settings.OriginProjectedCoordinatesNorthing,
+					Settings.OriginProjectedCoordinatesUp);
+				ProjectedToECEF(ProjectedOrigin, ECEFOrigin);
+
+				Impl->WorldFrameToECEFFrame = Impl->GetWorldFrameToECEFFrame(Impl->ProjectedEllipsoid, ECEFOrigin);
+			}
+			else
+			{
+				GeographicToECEF(FGeographicCoordinates(Settings.OriginLongitude, Settings.OriginLatitude, Settings.OriginAltitude), ECEFOrigin);
+				Impl->WorldFrameToECEFFrame = Impl->GetWorldFrameToECEFFrame(Impl->GeographicEllipsoid, ECEFOrigin);
+			}
+			Impl->ECEFFrameToWorldFrame = Impl->WorldFrameToECEFFrame.Inverse();
+		}
+		Impl->EngineToECEFTransform = FGeoAffineTransform::MakeScaleThenMatrix(FVector(0.01, -0.01, 0.01), Impl->WorldFrameToECEFFrame);
+		Impl->ECEFToEngineTransform = FGeoAffineTransform::MakeMatrixThenScale(Impl->ECEFFrameToWorldFrame, FVector(100.0, -100.0, 100.0));
+		break;
+
+	case EPlanetShape::FlatPlanet:
+	default:
+		if (bFromCookedState)
+		{
+			Impl->WorldOriginLocationProjected = CookedState.WorldOriginLocationProjected;
+		}
+		else if (Settings.bOriginLocationInProjectedCRS)
+		{
+			// World origin is expressed using Projected coordinates. Take them as is (in double)
+			Impl->WorldOriginLocationProjected = FVector(
+				Settings.OriginProjectedCoordinatesEasting,
+				Settings.OriginProjectedCoordinatesNorthing,
+				Settings.OriginProjectedCoordinatesUp);
+		}
+		else
+		{
+			// World origin is expressed using Geographic coordinates. Convert them to the projected CRS to have the offset
+			FVector OriginProjected;
+			GeographicToProjected(FGeographicCoordinates(Settings.OriginLongitude, Settings.OriginLatitude, Settings.OriginAltitude), OriginProjected);
+			Impl->WorldOriginLocationProjected = FVector(OriginProjected.X, OriginProjected.Y, OriginProjected.Z);
+		}
+		Impl->EngineToProjectedTransform = FGeoAffineTransform::MakeScaleThenMatrix(FVector(0.01, -0.01, 0.01), FTranslationMatrix(Impl->WorldOriginLocationProjected));
+		Impl->ProjectedToEngineTransform = FGeoAffineTransform::MakeMatrixThenScale(FTranslationMatrix(-Impl->WorldOriginLocationProjected), FVector(100.0, -100.0, 100.0));
+		break;
+	}
+}
+
+bool AGeoReferencingSystem::ApplyOriginInternal()
+{
+	GEOREFERENCING_SCOPE(OriginRebase);
+
+	Impl->WaitForInitialization();
+	const FProjPipelines Pipelines = Impl->GetPipelines();
+	if (Pipelines.ProjectedToGeographic == nullptr || Pipelines.ProjectedToECEF == nullptr || Pipelines.GeographicToECEF == nullptr)
+	{
+		return false;
+	}
+
+	// The pipelines, worker contexts, projection factors and local frames don't depend on the origin : only the transforms and what caches them change.
+	// Async batches and archives convert through the snapshot taken when they started, they are left running.
+	Impl->CoordinateCache.Invalidate();
+	{
+		FScopeLock Lock(&Impl->ApproximateTransformerMutex);
+		Impl->ApproximateTransformer.Reset();
+	}
+
+	const FAppliedSettings Settings = CaptureSettings();
+	ApplyOriginSettings(Settings, false);
+	Impl->SelectStreamKernels(Settings.PlanetShape == EPlanetShape::RoundPlanet);
+	Impl->PublishSnapshot(Settings.PlanetShape, Settings.ProjectedCRS, Settings.GeographicCRS, true);
+
+	Impl->CoordinateCache.Invalidate();
+	return true;
+}
+
+bool AGeoReferencingSystem::ApplyProjectionSettings(const FAppliedSettings& Settings)
+{
+	// Projected -> Geographic
+	if (Impl->ProjProjectedToGeographic != nullptr)
+	{
+		proj_destroy(Impl->ProjProjectedToGeographic);
+	}
+	Impl->ProjProjectedToGeographic = Impl->GetPROJProjection(Settings.ProjectedCRS, Settings.GeographicCRS);
+
+	// Projected -> Geocentric
+	if (Impl->ProjProjectedToECEF != nullptr)
+	{
+		proj_destroy(Impl->ProjProjectedToECEF);
+	}
+	Impl->ProjProjectedToECEF = Impl->GetPROJProjection(Settings.ProjectedCRS, ECEF_EPSG_FSTRING);
+
+	// Geographic -> Geocentric
+	if (Impl->ProjGeographicToECEF != nullptr)
+	{
+		proj_destroy(Impl->ProjGeographicToECEF);
+	}
+	Impl->ProjGeographicToECEF = Impl->GetPROJProjection(Settings.GeographicCRS, ECEF_EPSG_FSTRING);
+
+	// Projected CRS, for the projection factors. Optional : ENU vectors fall back to finite differences without it.
+	if (Impl->ProjProjectedCRS != nullptr)
+	{
+		proj_destroy(Impl->ProjProjectedCRS);
+	}
+	Impl->ProjProjectedCRS = Impl->GetPROJProjectedCRS(Settings.ProjectedCRS);
+
+	bool bProjectedEllipsoidSuccess = Impl->GetEllipsoid(Settings.ProjectedCRS, Impl->ProjectedEllipsoid);
+	bool bGeographicEllipsoidSuccess = Impl->GetEllipsoid(Settings.GeographicCRS, Impl->GeographicEllipsoid);
+
+	bool bSuccess = Impl->ProjProjectedToGeographic != nullptr && Impl->ProjProjectedToECEF != nullptr && Impl->ProjGeographicToECEF != nullptr && bProjectedEllipsoidSuccess && bGeographicEllipsoidSuccess;
+
+	// Replace PROJ by the closed-form Geographic <-> ECEF formulas if they give the same results
+	Impl->bNativeGeographicToECEF = false;
+	Impl->bNativeTransverseMercator = false;
+	if (bSuccess && Settings.bUseNativeConversions)
+	{
+		Impl->bNativeGeographicToECEF = Impl->ValidateNativeGeographicToECEF(Settings.NativeConversionToleranceMeters);
+		Impl->bNativeTransverseMercator = Impl->ConfigureNativeTransverseMercator(Settings.ProjectedCRS, Settings.NativeConversionToleranceMeters);
+	}
+
+	return bSuccess;
+}
+
+uint32 AGeoReferencingSystem::GetCookedSettingsHash(const FAppliedSettings& Settings)
+{
+	// Everything the resolved state depends on. The PROJ version is included since a newer database may resolve the same definitions differently.
+	const PJ_INFO ProjInfo = proj_info();
+	const FString Settings = FString::Printf(TEXT("%d|%s|%s|%d|%d|%.17g|%.17g|%.17g|%.17g|%.17g|%.17g|%d|%.17g|%s"),
+		static_cast<int32>(Settings.PlanetShape),
+		*Settings.ProjectedCRS,
+		*Settings.GeographicCRS,
+		Settings.bOriginAtPlanetCenter ? 1 : 0,
+		Settings.bOriginLocationInProjectedCRS ? 1 : 0,
+		Settings.OriginLatitude,
+		Settings.OriginLongitude,
+		Settings.OriginAltitude,
+		Settings.OriginProjectedCoordinatesEasting,
+		Settings.OriginProjectedCoordinatesNorthing,
+		Settings.OriginProjectedCoordinatesUp,
+		Settings.bUseNativeConversions ? 1 : 0,
+		Settings.NativeConversionToleranceMeters,
+		UTF8_TO_TCHAR(ProjInfo.version));
+
+	// 0 is reserved for "no cooked state"
+	return FMath::Max(1u, FCrc::StrCrc32(*Settings));
+}
+
+bool AGeoReferencingSystem::ApplyCookedState(const FAppliedSettings& Settings)
+{
+	// Only cooked builds use it, and only if the settings were not changed since the cook
+	if (!FPlatformProperties::RequiresCookedData() || CookedState.SettingsHash == 0 || CookedState.SettingsHash != GetCookedSettingsHash(Settings))
+	{
+		return false;
+	}
+
+	// PROJ strings are instantiated without any database query
+	auto CreateFromDefinition = [this](const FString& Definition) -> PJ*
+	{
+		return Definition.IsEmpty() ? nullptr : proj_create(Impl->ProjContext, TCHAR_TO_UTF8(*Definition));
+	};
+	PJ* ProjectedToGeographic = CreateFromDefinition(CookedState.ProjectedToGeographicDefinition);
+	PJ* ProjectedToECEF = CreateFromDefinition(CookedState.ProjectedToECEFDefinition);
+	PJ* GeographicToECEF = CreateFromDefinition(CookedState.GeographicToECEFDefinition);
+	PJ* ProjectedCRSPJ = CreateFromDefinition(CookedState.ProjectionDefinition);
+	if (ProjectedToGeographic == nullptr || ProjectedToECEF == nullptr || GeographicToECEF == nullptr)
+	{
+		for (PJ* Created : { ProjectedToGeographic, ProjectedToECEF, GeographicToECEF, ProjectedCRSPJ })
+		{
+			if (Created != nullptr)
+			{
+				proj_destroy(Created);
+			}
+		}
+		UE_LOG(LogGeoReferencing, Warning, TEXT("Cooked georeferencing state of %s could not be instantiated (%s), resolving the CRS definitions instead"), *GetPathName(), UTF8_TO_TCHAR(proj_errno_string(proj_context_errno(Impl->ProjContext))));
+		return false;
+	}
+
+	for (PJ** Existing : { &Impl->ProjProjectedToGeographic, &Impl->ProjProjectedToECEF, &Impl->ProjGeographicToECEF, &Impl->ProjProjectedCRS })
+	{
+		if (*Existing != nullptr)
+		{
+			proj_destroy(*Existing);
+		}
+	}
+	Impl->ProjProjectedToGeographic = ProjectedToGeographic;
+	Impl->ProjProjectedToECEF = ProjectedToECEF;
+	Impl->ProjGeographicToECEF = GeographicToECEF;
+	Impl->ProjProjectedCRS = ProjectedCRSPJ;
+	GEOREFERENCING_COUNTER_ADD(PipelinesBuilt, 3);
+
+	Impl->ProjectedEllipsoid = FEllipsoid(CookedState.ProjectedEllipsoidRadii);
+	Impl->GeographicEllipsoid = FEllipsoid(CookedState.GeographicEllipsoidRadii);
+
+	// The native conversions were validated against PROJ at cook time
+	Impl->bNativeGeographicToECEF = CookedState.bNativeGeographicToECEF;
+	Impl->bNativeTransverseMercator = CookedState.bNativeTransverseMercator;
+	if (Impl->bNativeTransverseMercator)
+	{
+		FTransverseMercator::FParameters Parameters;
+		Parameters.SemiMajorAxis = CookedState.TransverseMercatorSemiMajorAxis;
+		Parameters.Flattening = CookedState.TransverseMercatorFlattening;
+		Parameters.LatitudeOfOrigin = CookedState.TransverseMercatorLatitudeOfOrigin;
+		Parameters.CentralMeridian = CookedState.TransverseMercatorCentralMeridian;
+		Parameters.ScaleFactor = CookedState.TransverseMercatorScaleFactor;
+		Parameters.FalseEasting = CookedState.TransverseMercatorFalseEasting;
+		Parameters.FalseNorthing = CookedState.TransverseMercatorFalseNorthing;
+		Impl->TransverseMercator = FTransverseMercator(Parameters);
+	}
+
+	UE_LOG(LogGeoReferencing, Verbose, TEXT("Georeferencing state of %s applied from its cooked state"), *GetPathName());
+	return true;
+}
+
+#if WITH_EDITOR
+bool AGeoReferencingSystem::BuildCookedState(FGeoReferencingCookedState& OutState) const
+{
+	if (Impl->ProjProjectedToGeographic == nullptr || Impl->ProjProjectedToECEF == nullptr || Impl->ProjGeographicToECEF == nullptr)
+	{
+		UE_LOG(LogGeoReferencing, Warning, TEXT("Georeferencing state of %s not cooked : the CRS definitions could not be resolved"), *GetPathName());
+		return false;
+	}
+
+	// The returned string is owned by the PJ, copy it right away
+	auto GetDefinition = [this](PJ* Object, FString& OutDefinition)
+	{
+		const char* Definition = proj_as_proj_string(Impl->ProjContext, Object, PJ_PROJ_5, nullptr);
+		OutDefinition = Definition != nullptr ? FString(UTF8_TO_TCHAR(Definition)) : FString();
+		return !OutDefinition.IsEmpty();
+	};
+
+	// Transformations left with several candidate operations (picked per point by their area of use) have no PROJ string
+	if (!GetDefinition(Impl->ProjProjectedToGeographic, OutState.ProjectedToGeographicDefinition) ||
+		!GetDefinition(Impl->ProjProjectedToECEF, OutState.ProjectedToECEFDefinition) ||
+		!GetDefinition(Impl->ProjGeographicToECEF, OutState.GeographicToECEFDefinition))
+	{
+		UE_LOG(LogGeoReferencing, Warning, TEXT("Georeferencing state of %s not cooked : a transformation can't be expressed as a PROJ string, the PROJ database will be needed at runtime"), *GetPathName());
+		return false;
+	}
+
+	// Optional, the FlatPlanet ENU vectors fall back to finite differences without it
+	if (Impl->ProjProjectedCRS != nullptr)
+	{
+		GetDefinition(Impl->ProjProjectedCRS, OutState.ProjectionDefinition);
+	}
+
+	for (const FString* Definition : { &OutState.ProjectedToGeographicDefinition, &OutState.ProjectedToECEFDefinition, &OutState.GeographicToECEFDefinition })
+	{
+		if (Definition->Contains(TEXT("grids")))
+		{
+			UE_LOG(LogGeoReferencing, Warning, TEXT("Georeferencing state of %s uses a grid based transformation, its grid files must be packaged : %s"), *GetPathName(), **Definition);
+		}
+	}
+
+	OutState.ProjectedEllipsoidRadii = Impl->ProjectedEllipsoid.Radii;
+	OutState.GeographicEllipsoidRadii = Impl->GeographicEllipsoid.Radii;
+	OutState.WorldFrameToECEFFrame = Impl->WorldFrameToECEFFrame;
+	OutState.WorldOriginLocationProjected = Impl->WorldOriginLocationProjected;
+	OutState.bNativeGeographicToECEF = Impl->bNativeGeographicToECEF;
+	OutState.bNativeTransverseMercator = Impl->bNativeTransverseMercator;
+	if (Impl->bNativeTransverseMercator)
+	{
+		const FTransverseMercator::FParameters& Parameters = Impl->TransverseMercator.GetParameters();
+		OutState.TransverseMercatorSemiMajorAxis = Parameters.SemiMajorAxis;
+		OutState.TransverseMercatorFlattening = Parameters.Flattening;
+		OutState.TransverseMercatorLatitudeOfOrigin = Parameters.LatitudeOfOrigin;
+		OutState.TransverseMercatorCentralMeridian = Parameters.CentralMeridian;
+		OutState.TransverseMercatorScaleFactor = Parameters.ScaleFactor;
+		OutState.TransverseMercatorFalseEasting = Parameters.FalseEasting;
+		OutState.TransverseMercatorFalseNorthing = Parameters.FalseNorthing;
+	}
+	OutState.SettingsHash = GetCookedSettingsHash(CaptureSettings());
+	return true;
+}
+#endif
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::SelectStreamKernels(bool bRoundPlanet)
+{
+	StreamKernelConstants.EngineToECEF = EngineToECEFTransform;
+	StreamKernelConstants.ECEFToEngine = ECEFToEngineTransform;
+	StreamKernelConstants.EngineToProjected = EngineToProjectedTransform;
+	StreamKernelConstants.ProjectedToEngine = ProjectedToEngineTransform;
+	StreamKernelConstants.GeographicEllipsoid = GeographicEllipsoid;
+	StreamKernelConstants.TransverseMercator = TransverseMercator;
+
+	const int32 Mode = (bRoundPlanet ? 4 : 0) | (bNativeGeographicToECEF ? 2 : 0) | (bNativeTransverseMercator ? 1 : 0);
+	switch (Mode)
+	{
+	case 0: GeoStreamKernels::MakeKernels<false, false, false>(StreamKernels); break;
+	case 1: GeoStreamKernels::MakeKernels<false, false, true>(StreamKernels); break;
+	case 2: GeoStreamKernels::MakeKernels<false, true, false>(StreamKernels); break;
+	case 3: GeoStreamKernels::MakeKernels<false, true, true>(StreamKernels); break;
+	case 4: GeoStreamKernels::MakeKernels<true, false, false>(StreamKernels); break;
+	case 5: GeoStreamKernels::MakeKernels<true, false, true>(StreamKernels); break;
+	case 6: GeoStreamKernels::MakeKernels<true, true, false>(StreamKernels); break;
+	default: GeoStreamKernels::MakeKernels<true, true, true>(StreamKernels); break;
+	}
+}
+
+static void ProjLog(void* app_data, int level, const char* message)
+{
+	FUTF8ToTCHAR Message (message);
+	switch (level)
+	{
+	case PJ_LOG_ERROR:
+		UE_LOG(LogGeoReferencing, Error, TEXT("%s"), Message.Get());
+		break;
+	case PJ_LOG_DEBUG:
+		UE_LOG(LogGeoReferencing, Verbose, TEXT("%s"), Message.Get());
+		break;
+	case PJ_LOG_TRACE:
+		UE_LOG(LogGeoReferencing, VeryVerbose, TEXT("%s"), Message.Get());
+		break;
+	}
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::InitPROJLibrary()
+{
+	GEOREFERENCING_SCOPE(InitPROJLibrary);
+
+	// Initialize proj context
+	ProjContext = proj_context_create();
+	if (ProjContext == nullptr)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_create() failed"));
+		return;
+	}
+
+	// Calculate the search path to the PROJ data
+	FString PluginBaseDir = IPluginManager::Get().FindPlugin("GeoReferencing")->GetBaseDir();
+	ProjDataPath = FPaths::Combine(*PluginBaseDir, TEXT("Resources/PROJ"));
+
+	UE_LOG(LogGeoReferencing, Display, TEXT("Setting search path in %s "), *ProjDataPath);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FString ProjDBFilePath = FPaths::Combine(*ProjDataPath, TEXT("proj.db"));
+	PlatformFile.SetReadOnly(*ProjDBFilePath, true); // Set it read only so that with PROJ 9.1.1 SQLite doesn't open the file with a write lock
+	
+	// Special case for Dedicated Server or client
+	// When running in a sandboxed environment, the PROJ data files are not staged in that environment by the Cooking process. 
+	// And our SQLite accessor will always want to find these files in the sandboxed location, never in the original one. 
+	// And we don't want to have to build the PAK files when iterating on the code
+	// Let's manually populate the sandbox environment. 
+	if (PlatformFile.IsSandboxEnabled())
+	{
+		// Ask the system for the expected location of the proj.db file, using ConvertToAbsolutePathForExternalAppForWrite (not ***Read, that falls back on the original location)
+		FString ProjDBFileSandboxPath = PlatformFile.ConvertToAbsolutePathForExternalAppForWrite(*ProjDBFilePath);
+		UE_LOG(LogGeoReferencing, Warning, TEXT("Running in Sandboxed mode with Proj.db expected in %s "), *ProjDBFileSandboxPath);
+
+		// Check if the file is missing there
+		if (!IFileManager::Get().FileExists(*ProjDBFileSandboxPath))
+		{
+			UE_LOG(LogGeoReferencing, Warning, TEXT("Missing PROJ data files in then Sandbox environment --> Copy them!"));
+
+			// Create the target dir, and deploy the content. 
+			FString TargetFolder = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*ProjDataPath); // Use **Write for the actual Sandboxed path. 
+			PlatformFile.GetLowerLevel()->CreateDirectoryTree(*TargetFolder); // Use lower level Platformfile (otherwise the sandbox path is added twice)
+			PlatformFile.GetLowerLevel()->CopyDirectoryTree(*TargetFolder, *ProjDataPath, false);
+
+			PlatformFile.SetReadOnly(*ProjDBFileSandboxPath, true); // Set it read only so that with PROJ 9.1.1 SQLite doesn't open the file with a write lock
+		}
+	}
+
+	ConfigurePROJContext(ProjContext);
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::ConfigurePROJContext(PJ_CONTEXT* Context)
+{
+	ConfigurePROJContextWithDataPath(Context, ProjDataPath);
+}
+
+static void ConfigurePROJContextWithDataPath(PJ_CONTEXT* Context, const FString& ProjDataPath)
+{
+	// Connect PROJ logging
+	proj_log_func(Context, nullptr, ProjLog);
+	proj_log_level(Context, PJ_LOG_TRACE);
+
+	// Register the search path to the PROJ data
+	FTCHARToUTF8 Utf8ProjDataPath(*ProjDataPath);
+	const char* ProjSearchPaths[] =
+	{
+		Utf8ProjDataPath.Get(),
+	};
+	proj_context_set_search_paths(Context, sizeof(ProjSearchPaths)/sizeof(ProjSearchPaths[0]), ProjSearchPaths);
+
+	// With PROJ 9.1.1 this function does nothing
+	proj_context_set_autoclose_database(Context, true);
+
+	// Non-editor builds use UFS extensions to read PROJ data from UFS/Pak
+	if (!GIsEditor)
+	{
+		// Connect the UFS support for SQLite to PROJ
+		proj_context_set_sqlite3_vfs_name(Context, "unreal-fs");
+
+		// Setup UFS for PROJ
+		if (!proj_context_set_fileapi(Context, &FUFSProj::FunctionTable, nullptr))
+		{
+			UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_set_fileapi() failed"));
+		}
+	}
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::DeInitPROJLibrary()
+{
+	// Snapshots have their own contexts : the ones still referenced elsewhere outlive this
+	ReleaseSnapshots();
+
+	// Destroy worker contexts
+	{
+		FScopeLock Lock(&WorkerContextsMutex);
+		FreeWorkerContexts.Empty();
+		SourceWorkerContext.Reset();
+	}
+	{
+		FScopeLock Lock(&CRSPairTransformsMutex);
+		CRSPairTransforms.Empty();
+		if (CRSPairContext != nullptr)
+		{
+			proj_context_destroy(CRSPairContext);
+			CRSPairContext = nullptr;
+		}
+	}
+
+	// Destroy projections
+	if (ProjProjectedToGeographic != nullptr)
+	{
+		proj_destroy(ProjProjectedToGeographic);
+		ProjProjectedToGeographic = nullptr;
+	}
+	if (ProjProjectedToECEF != nullptr)
+	{
+		proj_destroy(ProjProjectedToECEF);
+		ProjProjectedToECEF = nullptr;
+	}
+	if (ProjGeographicToECEF != nullptr)
+	{
+		proj_destroy(ProjGeographicToECEF);
+		ProjGeographicToECEF = nullptr;
+	}
+	if (ProjProjectedCRS != nullptr)
+	{
+		proj_destroy(ProjProjectedCRS);
+		ProjProjectedCRS = nullptr;
+	}
+
+	// Destroy proj context
+	if (ProjContext != nullptr)
+	{
+		proj_context_destroy(ProjContext); /* may be omitted in the single threaded case */
+		ProjContext = nullptr;
+	}
+}
+
+bool AGeoReferencingSystem::FGeoReferencingSystemInternals::AcquireWorkerContexts(int32 NumWorkers, TArray<TUniquePtr<FProjWorkerContext>>& OutWorkerContexts)
+{
+	WaitForInitialization();
+
+	// The lock is only held while handing out the leases, never while the workers run
+	FScopeLock Lock(&WorkerContextsMutex);
+
+	while (OutWorkerContexts.Num() < NumWorkers)
+	{
+		TUniquePtr<FProjWorkerContext> WorkerContext = FreeWorkerContexts.Num() > 0 ? FreeWorkerContexts.Pop(false) : CreateWorkerContext();
+		if (!WorkerContext.IsValid())
+		{
+			ReleaseWorkerContexts(OutWorkerContexts);
+			return false;
+		}
+		OutWorkerContexts.Add(MoveTemp(WorkerContext));
+	}
+	return true;
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::ReleaseWorkerContexts(TArray<TUniquePtr<FProjWorkerContext>>& WorkerContexts)
+{
+	FScopeLock Lock(&WorkerContextsMutex);
+
+	// No batch runs more workers than the task graph threads plus the calling one, nor keeps more idle
+	const int32 MaxFreeWorkerContexts = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	for (TUniquePtr<FProjWorkerContext>& WorkerContext : WorkerContexts)
+	{
+		// Contexts cloned from outdated pipelines, and the ones above the bound, are simply destroyed
+		if (WorkerContext.IsValid() && WorkerContext->Generation == PipelinesGeneration && FreeWorkerContexts.Num() < MaxFreeWorkerContexts)
+		{
+			FreeWorkerContexts.Add(MoveTemp(WorkerContext));
+		}
+	}
+	WorkerContexts.Empty();
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::InvalidateWorkerContexts()
+{
+	FScopeLock Lock(&WorkerContextsMutex);
+
+	FreeWorkerContexts.Empty();
+	SourceWorkerContext.Reset();
+	PipelinesGeneration++;
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::RegisterAsyncBatch(const TSharedRef<FGeoBatchTaskHandle>& Task)
+{
+	FScopeLock Lock(&AsyncBatchesMutex);
+	AsyncBatches.Add(Task);
+	NoAsyncBatchesEvent->Reset();
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::UnregisterAsyncBatch(const TSharedRef<FGeoBatchTaskHandle>& Task)
+{
+	FScopeLock Lock(&AsyncBatchesMutex);
+	AsyncBatches.RemoveSingleSwap(Task, false);
+	if (AsyncBatches.Num() == 0)
+	{
+		NoAsyncBatchesEvent->Trigger();
+	}
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::CancelAsyncBatches()
+{
+	FScopeLock Lock(&AsyncBatchesMutex);
+	for (const TSharedRef<FGeoBatchTaskHandle>& Task : AsyncBatches)
+	{
+		Task->Cancel();
+	}
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::WaitForAsyncBatches()
+{
+	// Cancelled batches stop at their next step, within a few milliseconds. The event is reset and triggered with the lock held, it can't miss the last unregistration.
+	NoAsyncBatchesEvent->Wait();
+}
+
+float AGeoReferencingSystem::FGeoReferencingSystemInternals::GetAsyncBatchesProgress()
+{
+	FScopeLock Lock(&AsyncBatchesMutex);
+
+	int64 NumCoordinates = 0;
+	int64 NumConverted = 0;
+	for (const TSharedRef<FGeoBatchTaskHandle>& Task : AsyncBatches)
+	{
+		NumCoordinates += Task->GetNumCoordinates();
+		NumConverted += Task->GetNumConverted();
+	}
+	return NumCoordinates > 0 ? static_cast<float>(static_cast<double>(NumConverted) / static_cast<double>(NumCoordinates)) : 1.0f;
+}
+
+// New context holding proj_clone copies of the pipelines : the clones are attached to it, without querying the CRS database again
+static TUniquePtr<FProjWorkerContext> CloneWorkerContext(const FProjPipelines& SourcePipelines, PJ* SourceProjectedCRS, const FString& ProjDataPath)
+{
+	GEOREFERENCING_SCOPE(CreateWorkerContext);
+
+	if (SourcePipelines.ProjectedToGeographic == nullptr || SourcePipelines.ProjectedToECEF == nullptr || SourcePipelines.GeographicToECEF == nullptr)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FProjWorkerContext> WorkerContext = MakeUnique<FProjWorkerContext>();
+	WorkerContext->Context = proj_context_create();
+	if (WorkerContext->Context == nullptr)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_create() failed for worker context"));
+		return nullptr;
+	}
+	ConfigurePROJContextWithDataPath(WorkerContext->Context, ProjDataPath);
+
+	WorkerContext->Pipelines.ProjectedToGeographic = proj_clone(WorkerContext->Context, SourcePipelines.ProjectedToGeographic);
+	WorkerContext->Pipelines.ProjectedToECEF = proj_clone(WorkerContext->Context, SourcePipelines.ProjectedToECEF);
+	WorkerContext->Pipelines.GeographicToECEF = proj_clone(WorkerContext->Context, SourcePipelines.GeographicToECEF);
+
+	if (WorkerContext->Pipelines.ProjectedToGeographic == nullptr || WorkerContext->Pipelines.ProjectedToECEF == nullptr || WorkerContext->Pipelines.GeographicToECEF == nullptr)
+	{
+		int ErrorNumber = proj_context_errno(WorkerContext->Context);
+		FString ProjError = FString(proj_errno_string(ErrorNumber));
+		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::CreateWorkerContext failed in proj_clone : %s "), *ProjError);
+		return nullptr;
+	}
+
+	// Optional : without it the workers project the tangent directions by finite differences
+	if (SourceProjectedCRS != nullptr)
+	{
+		WorkerContext->ProjectedCRS = proj_clone(WorkerContext->Context, SourceProjectedCRS);
+	}
+
+	return WorkerContext;
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::BuildSourceWorkerContext()
+{
+	// Cloned outside of the lock, the main pipelines are only read on this thread
+	TUniquePtr<FProjWorkerContext> NewSourceWorkerContext = CloneWorkerContext({ ProjProjectedToGeographic, ProjProjectedToECEF, ProjGeographicToECEF }, ProjProjectedCRS, ProjDataPath);
+
+	FScopeLock Lock(&WorkerContextsMutex);
+	SourceWorkerContext = MoveTemp(NewSourceWorkerContext);
+	if (SourceWorkerContext.IsValid())
+	{
+		SourceWorkerContext->Generation = PipelinesGeneration;
+	}
+}
+
+TUniquePtr<FProjWorkerContext> AGeoReferencingSystem::FGeoReferencingSystemInternals::CreateWorkerContext()
+{
+	if (!SourceWorkerContext.IsValid())
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FProjWorkerContext> WorkerContext = CloneWorkerContext(SourceWorkerContext->Pipelines, SourceWorkerContext->ProjectedCRS, ProjDataPath);
+	if (WorkerContext.IsValid())
+	{
+		WorkerContext->Generation = PipelinesGeneration;
+	}
+	return WorkerContext;
+}
+
+// Transformer snapshots
+
+// PROJ contexts of the snapshots built on the same pipelines. An origin rebase publishes a new snapshot sharing the pool of the previous one.
+class FGeoSnapshotContextPool
+{
+public:
+	~FGeoSnapshotContextPool();
+
+	TUniquePtr<FProjWorkerContext> AcquireContext();
+	void ReleaseContext(TUniquePtr<FProjWorkerContext> Context);
+	void TrimIdleContexts();
+
+	FString ProjDataPath;
+
+	// Clones of the actor pipelines when the pool was built, never used to convert. They are only cloned in turn, with PoolMutex locked.
+	PJ_CONTEXT* SourceContext = nullptr;
+	FProjPipelines SourcePipelines;
+
+private:
+	TArray<TUniquePtr<FProjWorkerContext>> FreeContexts;
+	FCriticalSection PoolMutex;
+};
+
+class FGeoTransformerSnapshot::FState
+{
+public:
+	FGeoStreamKernel Kernels[static_cast<int32>(EGeoConversion::Count)] = {};
+	FGeoStreamKernelConstants KernelConstants;
+
+	TSharedPtr<FGeoSnapshotContextPool, ESPMode::ThreadSafe> Pool;
+};
+
+FGeoSnapshotContextPool::~FGeoSnapshotContextPool()
+{
+	FreeContexts.Empty();
+	for (PJ* Pipeline : { SourcePipelines.ProjectedToGeographic, SourcePipelines.ProjectedToECEF, SourcePipelines.GeographicToECEF })
+	{
+		if (Pipeline != nullptr)
+		{
+			proj_destroy(Pipeline);
+		}
+	}
+	if (SourceContext != nullptr)
+	{
+		proj_context_destroy(SourceContext);
+	}
+}
+
+TUniquePtr<FProjWorkerContext> FGeoSnapshotContextPool::AcquireContext()
+{
+	FScopeLock Lock(&PoolMutex);
+	if (FreeContexts.Num() > 0)
+	{
+		return FreeContexts.Pop(false);
+	}
+
+	if (SourcePipelines.ProjectedToGeographic == nullptr || SourcePipelines.ProjectedToECEF == nullptr || SourcePipelines.GeographicToECEF == nullptr)
+	{
+		return nullptr;
+	}
+
+	GEOREFERENCING_SCOPE(CreateWorkerContext);
+	TUniquePtr<FProjWorkerContext> WorkerContext = MakeUnique<FProjWorkerContext>();
+	WorkerContext->Context = proj_context_create();
+	if (WorkerContext->Context == nullptr)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_create() failed for snapshot context"));
+		return nullptr;
+	}
+	ConfigurePROJContextWithDataPath(WorkerContext->Context, ProjDataPath);
+
+	WorkerContext->Pipelines.ProjectedToGeographic = proj_clone(WorkerContext->Context, SourcePipelines.ProjectedToGeographic);
+	WorkerContext->Pipelines.ProjectedToECEF = proj_clone(WorkerContext->Context, SourcePipelines.ProjectedToECEF);
+	WorkerContext->Pipelines.GeographicToECEF = proj_clone(WorkerContext->Context, SourcePipelines.GeographicToECEF);
+	if (WorkerContext->Pipelines.ProjectedToGeographic == nullptr || WorkerContext->Pipelines.ProjectedToECEF == nullptr || WorkerContext->Pipelines.GeographicToECEF == nullptr)
+	{
+		int ErrorNumber = proj_context_errno(WorkerContext->Context);
+		FString ProjError = FString(proj_errno_string(ErrorNumber));
+		UE_LOG(LogGeoReferencing, Error, TEXT("FGeoTransformerSnapshot failed in proj_clone : %s "), *ProjError);
+		return nullptr;
+	}
+	return WorkerContext;
+}
+
+void FGeoSnapshotContextPool::ReleaseContext(TUniquePtr<FProjWorkerContext> Context)
+{
+	FScopeLock Lock(&PoolMutex);
+	FreeContexts.Add(MoveTemp(Context));
+}
+
+void FGeoSnapshotContextPool::TrimIdleContexts()
+{
+	FScopeLock Lock(&PoolMutex);
+	FreeContexts.Empty();
+}
+
+FGeoTransformerSnapshot::FGeoTransformerSnapshot()
+	: State(MakePimpl<FState>())
+{
+}
+
+FGeoTransformerSnapshot::~FGeoTransformerSnapshot() = default;
+
+bool FGeoTransformerSnapshot::Transform(EGeoConversion Conversion, const FGeoCoordinateStreams& Streams) const
+{
+	if (Conversion == EGeoConversion::Count || State->Kernels[static_cast<int32>(Conversion)] == nullptr)
+	{
+		return false;
+	}
+	if (Streams.Num <= 0)
+	{
+		return true;
+	}
+
+	TUniquePtr<FProjWorkerContext> Context = State->Pool->AcquireContext();
+	if (!Context.IsValid())
+	{
+		return false;
+	}
+
+	const FGeoStreamKernel Kernel = State->Kernels[static_cast<int32>(Conversion)];
+	for (int32 StartIndex = 0; StartIndex < Streams.Num; StartIndex += GeoReferencingBatchChunkSize)
+	{
+		const int32 Num = FMath::Min(GeoReferencingBatchChunkSize, Streams.Num - StartIndex);
+		Kernel(State->KernelConstants, Context->Pipelines, Streams.Slice(StartIndex, Num));
+	}
+
+	State->Pool->ReleaseContext(MoveTemp(Context));
+	return true;
+}
+
+bool FGeoTransformerSnapshot::Transform(EGeoConversion Conversion, TArrayView<FVector> Coordinates) const
+{
+	return Transform(Conversion, FGeoCoordinateStreams::Make(Coordinates));
+}
+
+bool FGeoTransformerSnapshot::Transform(EGeoConversion Conversion, FVector& Coordinates) const
+{
+	return Transform(Conversion, FGeoCoordinateStreams::Make(MakeArrayView(&Coordinates, 1)));
+}
+
+void FGeoTransformerSnapshot::TrimIdleContexts() const
+{
+	State->Pool->TrimIdleContexts();
+}
+
+// Shared by all the systems : a serial is never reused, even when Initialize() replaces the internals
+static std::atomic<uint32> GeoTransformerSnapshotSerials { 0 };
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::PublishSnapshot(EPlanetShape PlanetShape, const FString& ProjectedCRS, const FString& GeographicCRS, bool bKeepPipelines)
+{
+	// Only ApplySettings and RebaseOrigin write CurrentSnapshot, from the game thread : reading it here needs no lock
+	TSharedPtr<FGeoTransformerSnapshot, ESPMode::ThreadSafe> PreviousSnapshot = CurrentSnapshot;
+
+	TSharedRef<FGeoTransformerSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShareable(new FGeoTransformerSnapshot());
+	Snapshot->Serial = ++GeoTransformerSnapshotSerials;
+	Snapshot->PlanetShape = PlanetShape;
+	Snapshot->ProjectedCRS = ProjectedCRS;
+	Snapshot->GeographicCRS = GeographicCRS;
+
+	FGeoTransformerSnapshot::FState& SnapshotState = *Snapshot->State;
+	FMemory::Memcpy(SnapshotState.Kernels, StreamKernels, sizeof(StreamKernels));
+	SnapshotState.KernelConstants = StreamKernelConstants;
+
+	// The pipelines are the same, and so are the contexts of the previous snapshot : share them instead of cloning everything again
+	const bool bSharePool = bKeepPipelines && PreviousSnapshot.IsValid();
+	if (bSharePool)
+	{
+		SnapshotState.Pool = PreviousSnapshot->State->Pool;
+	}
+	else
+	{
+		SnapshotState.Pool = MakeShared<FGeoSnapshotContextPool, ESPMode::ThreadSafe>();
+		SnapshotState.Pool->ProjDataPath = ProjDataPath;
+
+		// The snapshot gets its own copies of the pipelines : the actor ones are destroyed by the next ApplySettings
+		if (ProjProjectedToGeographic != nullptr && ProjProjectedToECEF != nullptr && ProjGeographicToECEF != nullptr)
+		{
+			FGeoSnapshotContextPool& Pool = *SnapshotState.Pool;
+			Pool.SourceContext = proj_context_create();
+			if (Pool.SourceContext != nullptr)
+			{
+				ConfigurePROJContext(Pool.SourceContext);
+				Pool.SourcePipelines.ProjectedToGeographic = proj_clone(Pool.SourceContext, ProjProjectedToGeographic);
+				Pool.SourcePipelines.ProjectedToECEF = proj_clone(Pool.SourceContext, ProjProjectedToECEF);
+				Pool.SourcePipelines.GeographicToECEF = proj_clone(Pool.SourceContext, ProjGeographicToECEF);
+			}
+		}
+	}
+
+	{
+		FWriteScopeLock Lock(CurrentSnapshotLock);
+		CurrentSnapshot = Snapshot;
+	}
+	CurrentSnapshotSerial.store(Snapshot->Serial, std::memory_order_release);
+
+	// Handles still held elsewhere keep the previous snapshot alive : give back its idle contexts now, the state goes with the last handle
+	if (PreviousSnapshot.IsValid() && !bSharePool)
+	{
+		PreviousSnapshot->TrimIdleContexts();
+	}
+}
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::ReleaseSnapshots()
+{
+	TSharedPtr<FGeoTransformerSnapshot, ESPMode::ThreadSafe> PreviousSnapshot;
+	{
+		FWriteScopeLock Lock(CurrentSnapshotLock);
+		PreviousSnapshot = MoveTemp(CurrentSnapshot);
+	}
+
+	if (PreviousSnapshot.IsValid())
+	{
+		PreviousSnapshot->TrimIdleContexts();
+	}
+}
+
+TSharedPtr<const FGeoTransformerSnapshot, ESPMode::ThreadSafe> AGeoReferencingSystem::GetTransformerSnapshot() const
+{
+	// The first snapshot is published by the initialization
+	Impl->WaitForInitialization();
+
+	FReadScopeLock Lock(Impl->CurrentSnapshotLock);
+	return Impl->CurrentSnapshot;
+}
+
+uint32 AGeoReferencingSystem::GetSettingsSerial() const
+{
+	return Impl ? Impl->CurrentSnapshotSerial.load(std::memory_order_acquire) : 0;
+}
+
+PJ* AGeoReferencingSystem::FGeoReferencingSystemInternals::GetPROJProjection(FString SourceCRS, FString DestinationCRS, PJ_CONTEXT* Context)
+{
+	GEOREFERENCING_SCOPE(GetPROJProjection);
+
+	if (Context == nullptr)
+	{
+		Context = ProjContext;
+	}
+
+	FTCHARToUTF8 ConvertSource(*SourceCRS);
+	FTCHARToUTF8 ConvertDestination(*DestinationCRS);
+	const ANSICHAR* Source = ConvertSource.Get();
+	const ANSICHAR* Destination = ConvertDestination.Get();
+
+	GEOREFERENCING_COUNTER_ADD(ProjDatabaseQueries, 1);
+	PJ* TempPJ = proj_create_crs_to_crs(Context, Source, Destination, nullptr);
+	if (TempPJ == nullptr)
+	{
+		int ErrorNumber = proj_context_errno(Context);
+		FString ProjError = FString(proj_errno_string(ErrorNumber));
+		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::BuildProjection failed in proj_create_crs_to_crs : %s "), *ProjError);
+
+		UE_LOG(LogGeoReferencing, Display, TEXT("SourceCRS was : %s "), *SourceCRS);
+		UE_LOG(LogGeoReferencing, Display, TEXT("DestinationCRS was : %s "), *DestinationCRS);
+
+		return nullptr;
+	}
+
+	/* This will ensure that the order of coordinates for the input CRS */
+	/* will be longitude, latitude, whereas EPSG:4326 mandates latitude, longitude */
+	PJ* P_for_GIS = proj_normalize_for_visualization(Context, TempPJ);
+	if (P_for_GIS == nullptr)
+	{
+		int ErrorNumber = proj_context_errno(Context);
+		FString ProjError = FString(proj_errno_string(ErrorNumber));
+		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::BuildProjection failed in proj_normalize_for_visualization : %s "), *ProjError);
+	}
+
+	proj_destroy(TempPJ);
+	if (P_for_GIS != nullptr)
+	{
+		GEOREFERENCING_COUNTER_ADD(PipelinesBuilt, 1);
+	}
+	return P_for_GIS;
+}
+
+PJ* AGeoReferencingSystem::FGeoReferencingSystemInternals::GetPROJProjectedCRS(const FString& ProjectedCRS)
+{
+	GEOREFERENCING_COUNTER_ADD(ProjDatabaseQueries, 1);
+	PJ* CRSPJ = proj_create(ProjContext, TCHAR_TO_UTF8(*ProjectedCRS));
+	if (CRSPJ == nullptr)
+	{
+		return nullptr;
+	}
+
+	// proj_factors only knows how to differentiate projections
+	if (proj_get_type(CRSPJ) != PJ_TYPE_PROJECTED_CRS)
+	{
+		UE_LOG(LogGeoReferencing, Verbose, TEXT("Projected CRS %s is not a projection, projection factors will not be available"), *ProjectedCRS);
+		proj_destroy(CRSPJ);
+		return nullptr;
+	}
+	return CRSPJ;
+}
+
+TSharedPtr<FCRSPairTransform> AGeoReferencingSystem::FGeoReferencingSystemInternals::FindOrAddCRSPairTransform(const FString& SourceCRS, const FString& TargetCRS, int32 Capacity)
+{
+	WaitForInitialization();
+
+	Capacity = FMath::Max(1, Capacity);
+	if (CRSPairTransforms.Max() != Capacity)
+	{
+		// The cache can't be resized : rebuild it with the most recently used pipelines, least recent first so that the order is kept
+		TArray<TPair<TPair<FString, FString>, TSharedPtr<FCRSPairTransform>>> Kept;
+		for (TLruCache<TPair<FString, FString>, TSharedPtr<FCRSPairTransform>>::TConstIterator It(CRSPairTransforms); It && Kept.Num() < Capacity; ++It)
+		{
+			Kept.Emplace(It.Key(), It.Value());
+		}
+		CRSPairTransforms.Empty(Capacity);
+		for (int32 Index = Kept.Num() - 1; Index >= 0; --Index)
+		{
+			CRSPairTransforms.Add(Kept[Index].Key, Kept[Index].Value);
+		}
+	}
+
+	const TPair<FString, FString> Key(SourceCRS, TargetCRS);
+	if (const TSharedPtr<FCRSPairTransform>* Found = CRSPairTransforms.FindAndTouch(Key))
+	{
+		return *Found;
+	}
+
+	if (CRSPairContext == nullptr)
+	{
+		CRSPairContext = proj_context_create();
+		if (CRSPairContext == nullptr)
+		{
+			UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_create() failed for the CRS pairs registry"));
+			return nullptr;
+		}
+		ConfigurePROJContext(CRSPairContext);
+	}
+
+	// Failures are not cached, the CRS strings may be edited until they are valid
+	PJ* Pipeline = GetPROJProjection(SourceCRS, TargetCRS, CRSPairContext);
+	if (Pipeline == nullptr)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FCRSPairTransform> Transform = MakeShared<FCRSPairTransform>();
+	Transform->Pipeline = Pipeline;
+	Transform->Accuracy = ComputeTransformationAccuracy(Pipeline);
+	CRSPairTransforms.Add(Key, Transform);
+	return Transform;
+}
+
+FTransformationAccuracy AGeoReferencingSystem::FGeoReferencingSystemInternals::ComputeTransformationAccuracy(PJ* Pipeline) const
+{
+	FTransformationAccuracy Accuracy;
+
+	double HorizAccuracy = -1.0;
+	double VertAccuracy = -1.0;
+	// Query accuracy from PROJ (requires PROJ 6.0+)
+	// Note: proj_trans_get_accuracy returns -1 if accuracy is unknown
+#if defined(PROJ_VERSION_MAJOR) && PROJ_VERSION_MAJOR >= 9
+	HorizAccuracy = VertAccuracy= proj_coordoperation_get_accuracy(CRSPairContext, Pipeline);
+#else
+	// proj_trans_get_accuracy not available in this PROJ version — leave as -1 (unknown)
+	UE_LOG(LogGeoReferencing, Verbose, TEXT("proj_trans_get_accuracy not available in this PROJ build; returning unknown accuracy"));
+
+#endif
+	Accuracy.HorizontalAccuracyMeters = HorizAccuracy;
+	Accuracy.VerticalAccuracyMeters = VertAccuracy;
 
-	// Calculate and register the search path to the PROJ data
-	FString PluginBaseDir = IPluginManager::Get().FindPlugin("GeoReferencing")->GetBaseDir();
-	FString ProjDataPath = FPaths::Combine(*PluginBaseDir, TEXT("Resources/PROJ"));
+	// Get information about the transformation
+	PJ_PROJ_INFO info = proj_pj_info(Pipeline);
+	if (info.definition)
+	{
+		Accuracy.TransformationMethod = FString(UTF8_TO_TCHAR(info.definition));
+	}
 
-	UE_LOG(LogGeoReferencing, Display, TEXT("Setting search path in %s "), *ProjDataPath);
+	// Check if transformation uses grid files
+	Accuracy.bIsGridBased = Accuracy.TransformationMethod.Contains(TEXT("grid")) || 
+	                        Accuracy.TransformationMethod.Contains(TEXT("nadgrid"));
 
+	return Accuracy;
+}
 
-	FTCHARToUTF8 Utf8ProjDataPath(*ProjDataPath);
-	const char* ProjSearchPaths[] =
+bool AGeoReferencingSystem::FGeoReferencingSystemInternals::ValidateNativeGeographicToECEF(double ToleranceMeters)
+{
+	if (!GeographicEllipsoid.IsOfRevolution())
 	{
-		Utf8ProjDataPath.Get(),
-	};
-	proj_context_set_search_paths(ProjContext, sizeof(ProjSearchPaths)/sizeof(ProjSearchPaths[0]), ProjSearchPaths);
+		return false;
+	}
 
-	// With PROJ 9.1.1 this function does nothing
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	proj_context_set_autoclose_database(ProjContext, true);
-	FString ProjDBFilePath = FPaths::Combine(*ProjDataPath, TEXT("proj.db"));
-	PlatformFile.SetReadOnly(*ProjDBFilePath, true); // Set it read only so that with PROJ 9.1.1 SQLite doesn't open the file with a write lock
-	
-	// Special case for Dedicated Server or client
-	// When running in a sandboxed environment, the PROJ data files are not staged in that environment by the Cooking process. 
-	// And our SQLite accessor will always want to find these files in the sandboxed location, never in the original one. 
-	// And we don't want to have to build the PAK files when iterating on the code
-	// Let's manually populate the sandbox environment. 
-	if (PlatformFile.IsSandboxEnabled())
+	// Grid based transformations are local, they can't be validated by sampling
+	PJ_PROJ_INFO Info = proj_pj_info(ProjGeographicToECEF);
+	if (Info.definition != nullptr && FString(UTF8_TO_TCHAR(Info.definition)).Contains(TEXT("grids")))
 	{
-		// Ask the system for the expected location of the proj.db file, using ConvertToAbsolutePathForExternalAppForWrite (not ***Read, that falls back on the original location)
-		FString ProjDBFileSandboxPath = PlatformFile.ConvertToAbsolutePathForExternalAppForWrite(*ProjDBFilePath);
-		UE_LOG(LogGeoReferencing, Warning, TEXT("Running in Sandboxed mode with Proj.db expected in %s "), *ProjDBFileSandboxPath);
-
-		// Check if the file is missing there
-		if (!IFileManager::Get().FileExists(*ProjDBFileSandboxPath))
-		{
-			UE_LOG(LogGeoReferencing, Warning, TEXT("Missing PROJ data files in then Sandbox environment --> Copy them!"));
+		UE_LOG(LogGeoReferencing, Display, TEXT("Geographic to ECEF transformation uses grids, native conversion disabled"));
+		return false;
+	}
 
-			// Create the target dir, and deploy the content. 
-			FString TargetFolder = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*ProjDataPath); // Use **Write for the actual Sandboxed path. 
-			PlatformFile.GetLowerLevel()->CreateDirectoryTree(*TargetFolder); // Use lower level Platformfile (otherwise the sandbox path is added twice)
-			PlatformFile.GetLowerLevel()->CopyDirectoryTree(*TargetFolder, *ProjDataPath, false);
+	// Sample both implementations over the planet, any datum shift or ellipsoid mismatch shows up as a large error
+	const double Latitudes[] = { -89.9, -75.0, -45.0, -10.0, 0.0, 10.0, 45.0, 75.0, 89.9 };
+	const double Longitudes[] = { -179.9, -120.0, -60.0, 0.0, 60.0, 120.0, 179.9 };
+	const double Altitudes[] = { -500.0, 0.0, 10000.0, 400000.0 };
+	const double Radius = GeographicEllipsoid.Radii.X;
 
-			PlatformFile.SetReadOnly(*ProjDBFileSandboxPath, true); // Set it read only so that with PROJ 9.1.1 SQLite doesn't open the file with a write lock
-		}
-	}
-	// Non-editor builds use UFS extensions to read PROJ data from UFS/Pak
-	if (!GIsEditor)
+	double MaxError = 0.0;
+	for (double Latitude : Latitudes)
 	{
-		// Connect the UFS support for SQLite to PROJ
-		proj_context_set_sqlite3_vfs_name(ProjContext, "unreal-fs");
-
-		// Setup UFS for PROJ
-		if (!proj_context_set_fileapi(ProjContext, &FUFSProj::FunctionTable, nullptr))
+		for (double Longitude : Longitudes)
 		{
-			UE_LOG(LogGeoReferencing, Error, TEXT("proj_context_set_fileapi() failed"));
+			for (double Altitude : Altitudes)
+			{
+				FGeographicCoordinates Geographic;
+				Geographic.Longitude = Longitude;
+				Geographic.Latitude = Latitude;
+				Geographic.Altitude = Altitude;
+
+				PJ_COORD Output = proj_trans(ProjGeographicToECEF, PJ_FWD, proj_coord(Longitude, Latitude, Altitude, 0));
+				FVector ProjECEF(Output.xyz.x, Output.xyz.y, Output.xyz.z);
+				MaxError = FMathd::Max(MaxError, FVector::Distance(ProjECEF, GeographicEllipsoid.GeographicToECEF(Geographic)));
+
+				// Inverse, error expressed in meters on the ellipsoid
+				FGeographicCoordinates NativeGeographic = GeographicEllipsoid.ECEFToGeographic(ProjECEF);
+				Output = proj_trans(ProjGeographicToECEF, PJ_INV, Output);
+				const double LatitudeError = FMathd::DegToRad * FMathd::Abs(NativeGeographic.Latitude - Output.lpz.phi) * Radius;
+				const double LongitudeError = FMathd::DegToRad * FMathd::Abs(NativeGeographic.Longitude - Output.lpz.lam) * Radius * FMathd::Cos(FMathd::DegToRad * Latitude);
+				const double AltitudeError = FMathd::Abs(NativeGeographic.Altitude - Output.lpz.z);
+				MaxError = FMathd::Max(MaxError, FMathd::Max3(LatitudeError, LongitudeError, AltitudeError));
+			}
 		}
 	}
+
+	const bool bValid = FMathd::IsFinite(MaxError) && MaxError <= ToleranceMeters;
+	UE_LOG(LogGeoReferencing, Display, TEXT("Native Geographic to ECEF conversion %s (maximum difference with PROJ %g m, tolerance %g m)"), bValid ? TEXT("enabled") : TEXT("disabled"), MaxError, ToleranceMeters);
+	return bValid;
 }
 
-void AGeoReferencingSystem::FGeoReferencingSystemInternals::DeInitPROJLibrary()
+// Read the parameters of a projected CRS using the Transverse Mercator method (EPSG:9807), false for any other CRS
+static bool GetTransverseMercatorParameters(PJ_CONTEXT* Context, PJ* CRS, FTransverseMercator::FParameters& OutParameters)
 {
-	// Destroy projections
-	if (ProjProjectedToGeographic != nullptr)
+	if (proj_get_type(CRS) != PJ_TYPE_PROJECTED_CRS)
 	{
-		proj_destroy(ProjProjectedToGeographic);
-		ProjProjectedToGeographic = nullptr;
+		return false;
 	}
-	if (ProjProjectedToECEF != nullptr)
+
+	bool bSuccess = false;
+	PJ* Conversion = proj_crs_get_coordoperation(Context, CRS);
+	PJ* Ellipsoid = proj_get_ellipsoid(Context, CRS);
+	if (Conversion != nullptr && Ellipsoid != nullptr)
 	{
-		proj_destroy(ProjProjectedToECEF);
-		ProjProjectedToECEF = nullptr;
+		const char* MethodAuthority = nullptr;
+		const char* MethodCode = nullptr;
+		proj_coordoperation_get_method_info(Context, Conversion, nullptr, &MethodAuthority, &MethodCode);
+		if (MethodAuthority != nullptr && MethodCode != nullptr && FCStringAnsi::Strcmp(MethodAuthority, "EPSG") == 0 && FCStringAnsi::Strcmp(MethodCode, "9807") == 0)
+		{
+			// Parameter values converted to SI units (radians, meters, unity) by their conversion factor
+			int32 NumParametersFound = 0;
+			const int NumParameters = proj_coordoperation_get_param_count(Context, Conversion);
+			for (int Index = 0; Index < NumParameters; ++Index)
+			{
+				const char* ParameterAuthority = nullptr;
+				const char* ParameterCode = nullptr;
+				double Value = 0.0;
+				double UnitConversionFactor = 1.0;
+				proj_coordoperation_get_param(Context, Conversion, Index, nullptr, &ParameterAuthority, &ParameterCode, &Value, nullptr, &UnitConversionFactor, nullptr, nullptr, nullptr, nullptr);
+				if (ParameterAuthority == nullptr || ParameterCode == nullptr || FCStringAnsi::Strcmp(ParameterAuthority, "EPSG") != 0)
+				{
+					continue;
+				}
+
+				const double SIValue = Value * UnitConversionFactor;
+				switch (FCStringAnsi::Atoi(ParameterCode))
+				{
+				case 8801: OutParameters.LatitudeOfOrigin = FMathd::RadToDeg * SIValue; ++NumParametersFound; break;
+				case 8802: OutParameters.CentralMeridian = FMathd::RadToDeg * SIValue; ++NumParametersFound; break;
+				case 8805: OutParameters.ScaleFactor = SIValue; ++NumParametersFound; break;
+				case 8806: OutParameters.FalseEasting = SIValue; ++NumParametersFound; break;
+				case 8807: OutParameters.FalseNorthing = SIValue; ++NumParametersFound; break;
+				default: break;
+				}
+			}
+
+			double SemiMajorAxis = 0.0;
+			double SemiMinorAxis = 0.0;
+			int bIsSemiMinorComputed = 0;
+			double InverseFlattening = 0.0;
+			if (proj_ellipsoid_get_parameters(Context, Ellipsoid, &SemiMajorAxis, &SemiMinorAxis, &bIsSemiMinorComputed, &InverseFlattening) && SemiMajorAxis > 0.0)
+			{
+				OutParameters.SemiMajorAxis = SemiMajorAxis;
+				OutParameters.Flattening = (SemiMajorAxis - SemiMinorAxis) / SemiMajorAxis;
+				bSuccess = NumParametersFound == 5;
+			}
+		}
 	}
-	if (ProjGeographicToECEF != nullptr)
+
+	if (Conversion != nullptr)
 	{
-		proj_destroy(ProjGeographicToECEF);
-		ProjGeographicToECEF = nullptr;
+		proj_destroy(Conversion);
 	}
-
-	// Destroy proj context
-	if (ProjContext != nullptr)
+	if (Ellipsoid != nullptr)
 	{
-		proj_context_destroy(ProjContext); /* may be omitted in the single threaded case */
-		ProjContext = nullptr;
+		proj_destroy(Ellipsoid);
 	}
+	return bSuccess;
 }
 
-PJ* AGeoReferencingSystem::FGeoReferencingSystemInternals::GetPROJProjection(FString SourceCRS, FString DestinationCRS)
+bool AGeoReferencingSystem::FGeoReferencingSystemInternals::ConfigureNativeTransverseMercator(const FString& ProjectedCRS, double ToleranceMeters)
 {
-	FTCHARToUTF8 ConvertSource(*SourceCRS);
-	FTCHARToUTF8 ConvertDestination(*DestinationCRS);
-	const ANSICHAR* Source = ConvertSource.Get();
-	const ANSICHAR* Destination = ConvertDestination.Get();
+	// Detect a Transverse Mercator CRS (UTM zones and national grids) from its parameters
+	FTransverseMercator::FParameters Parameters;
+	FTCHARToUTF8 ConvertProjectedCRS(*ProjectedCRS);
+	GEOREFERENCING_COUNTER_ADD(ProjDatabaseQueries, 1);
+	PJ* CRS = proj_create(ProjContext, ConvertProjectedCRS.Get());
+	if (CRS == nullptr)
+	{
+		return false;
+	}
+	const bool bIsTransverseMercator = GetTransverseMercatorParameters(ProjContext, CRS, Parameters);
+	proj_destroy(CRS);
+	if (!bIsTransverseMercator)
+	{
+		return false;
+	}
 
-	PJ* TempPJ = proj_create_crs_to_crs(ProjContext, Source, Destination, nullptr);
-	if (TempPJ == nullptr)
+	// Grid based datum shifts between the Projected and Geographic CRS can't be reproduced
+	PJ_PROJ_INFO Info = proj_pj_info(ProjProjectedToGeographic);
+	if (Info.definition != nullptr && FString(UTF8_TO_TCHAR(Info.definition)).Contains(TEXT("grids")))
 	{
-		int ErrorNumber = proj_context_errno(ProjContext);
-		FString ProjError = FString(proj_errno_string(ErrorNumber));
-		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::BuildProjection failed in proj_create_crs_to_crs : %s "), *ProjError);
+		UE_LOG(LogGeoReferencing, Display, TEXT("Projected to Geographic transformation uses grids, native Transverse Mercator disabled"));
+		return false;
+	}
 
-		UE_LOG(LogGeoReferencing, Display, TEXT("SourceCRS was : %s "), *SourceCRS);
-		UE_LOG(LogGeoReferencing, Display, TEXT("DestinationCRS was : %s "), *DestinationCRS);
+	TransverseMercator = FTransverseMercator(Parameters);
 
-		return nullptr;
-	}
+	// Sample both implementations across the zone (6 degrees wide for UTM, plus margin). Any datum shift, unit or axis mismatch shows up as a large error
+	const double Latitudes[] = { -80.0, -60.0, -30.0, -10.0, 0.0, 10.0, 30.0, 60.0, 84.0 };
+	const double LongitudeOffsets[] = { -3.5, -2.0, -0.5, 0.0, 0.5, 2.0, 3.5 };
+	const double Altitudes[] = { 0.0, 1000.0 };
+	const double Radius = Parameters.SemiMajorAxis;
 
-	/* This will ensure that the order of coordinates for the input CRS */
-	/* will be longitude, latitude, whereas EPSG:4326 mandates latitude, longitude */
-	PJ* P_for_GIS = proj_normalize_for_visualization(ProjContext, TempPJ);
-	if (P_for_GIS == nullptr)
+	double MaxError = 0.0;
+	for (double Latitude : Latitudes)
 	{
-		int ErrorNumber = proj_context_errno(ProjContext);
-		FString ProjError = FString(proj_errno_string(ErrorNumber));
-		UE_LOG(LogGeoReferencing, Error, TEXT("AGeoReferencingSystem::BuildProjection failed in proj_normalize_for_visualization : %s "), *ProjError);
+		for (double LongitudeOffset : LongitudeOffsets)
+		{
+			for (double Altitude : Altitudes)
+			{
+				const double Longitude = Parameters.CentralMeridian + LongitudeOffset;
+				const FGeographicCoordinates Geographic(Longitude, Latitude, Altitude);
+
+				PJ_COORD Output = proj_trans(ProjProjectedToGeographic, PJ_INV, proj_coord(Longitude, Latitude, Altitude, 0));
+				const FVector ProjProjected(Output.xyz.x, Output.xyz.y, Output.xyz.z);
+				MaxError = FMathd::Max(MaxError, FVector::Distance(ProjProjected, TransverseMercator.GeographicToProjected(Geographic)));
+
+				// Inverse, error expressed in meters on the ellipsoid
+				const FGeographicCoordinates NativeGeographic = TransverseMercator.ProjectedToGeographic(ProjProjected);
+				Output = proj_trans(ProjProjectedToGeographic, PJ_FWD, Output);
+				const double LatitudeError = FMathd::DegToRad * FMathd::Abs(NativeGeographic.Latitude - Output.lpz.phi) * Radius;
+				const double LongitudeError = FMathd::DegToRad * FMathd::Abs(NativeGeographic.Longitude - Output.lpz.lam) * Radius * FMathd::Cos(FMathd::DegToRad * Latitude);
+				const double AltitudeError = FMathd::Abs(NativeGeographic.Altitude - Output.lpz.z);
+				MaxError = FMathd::Max(MaxError, FMathd::Max3(LatitudeError, LongitudeError, AltitudeError));
+			}
+		}
 	}
 
-	proj_destroy(TempPJ);
-	return P_for_GIS;
+	const bool bValid = FMathd::IsFinite(MaxError) && MaxError <= ToleranceMeters;
+	UE_LOG(LogGeoReferencing, Display, TEXT("Native Transverse Mercator projection %s (maximum difference with PROJ %g m, tolerance %g m)"), bValid ? TEXT("enabled") : TEXT("disabled"), MaxError, ToleranceMeters);
+	return bValid;
 }
 
 FMatrix AGeoReferencingSystem::FGeoReferencingSystemInternals::GetWorldFrameToECEFFrame(const FEllipsoid& Ellipsoid, const FVector& ECEFLocation)
@@ -1368,6 +4201,261 @@ FMatrix AGeoReferencingSystem::FGeoReferencingSystemInternals::GetWorldFrameToEC
 	}
 }
 
+/////// LOCAL FRAMES GRID
+
+// Above this, a grid is most likely a settings mistake (0.01 degree cells over the whole planet would take 80 GB)
+static constexpr int32 GeoReferencingMaxLocalFrameCells = 1 << 20;
+
+void AGeoReferencingSystem::FGeoReferencingSystemInternals::BuildLocalFrameGrid(const FAppliedSettings& AppliedSettings)
+{
+	if (!AppliedSettings.bUseLocalFrameGrid)
+	{
+		LocalFrameCells.Empty();
+		LocalFrameGridColumns = 0;
+		LocalFrameGridRows = 0;
+		LocalFrameGridSettings.Reset();
+		return;
+	}
+
+	// The cells only depend on these, not on the origin nor on the projected CRS
+	FLocalFrameGridSettings Settings;
+	Settings.CellSize = FMath::Max(AppliedSettings.LocalFrameGridCellSizeDegrees, 0.01);
+	Settings.MinLongitude = AppliedSettings.LocalFrameGridMinLongitude;
+	Settings.MaxLongitude = AppliedSettings.LocalFrameGridMaxLongitude;
+	Settings.MinLatitude = AppliedSettings.LocalFrameGridMinLatitude;
+	Settings.MaxLatitude = AppliedSettings.LocalFrameGridMaxLatitude;
+	Settings.GeographicCRS = AppliedSettings.GeographicCRS;
+	if (LocalFrameGridSettings.IsSet() && LocalFrameGridSettings.GetValue() == Settings)
+	{
+		return;
+	}
+
+	LocalFrameCells.Reset();
+	LocalFrameGridColumns = 0;
+	LocalFrameGridRows = 0;
+	LocalFrameGridSettings.Reset();
+
+	if (Settings.MaxLatitude < Settings.MinLatitude)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("Local frames grid minimum latitude %g is above the maximum latitude %g, the grid is not built"), Settings.MinLatitude, Settings.MaxLatitude);
+		return;
+	}
+
+	// A minimum longitude above the maximum one is a range crossing the antimeridian. FindLocalFrameCell wraps the longitudes around.
+	LocalFrameGridCellSize = Settings.CellSize;
+	LocalFrameGridMinLongitude = Settings.MinLongitude;
+	LocalFrameGridMinLatitude = Settings.MinLatitude;
+	const double LongitudeSpan = Settings.MaxLongitude - Settings.MinLongitude;
+	const double LongitudeRange = FMath::Clamp(LongitudeSpan < 0.0 ? LongitudeSpan + 360.0 : LongitudeSpan, 0.0, 360.0);
+	const double LatitudeRange = FMath::Clamp(Settings.MaxLatitude - Settings.MinLatitude, 0.0, 180.0);
+	const int64 Columns = FMath::Max<int64>(1, FMath::CeilToInt64(LongitudeRange / LocalFrameGridCellSize));
+	const int64 Rows = FMath::Max<int64>(1, FMath::CeilToInt64(LatitudeRange / LocalFrameGridCellSize));
+	if (Columns * Rows > GeoReferencingMaxLocalFrameCells)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("Local frames grid of %lld x %lld cells is too large (maximum %d cells), increase the cell size or reduce the area"), Columns, Rows, GeoReferencingMaxLocalFrameCells);
+		return;
+	}
+
+	const FGeoStreamKernel GeographicToECEFKernel = StreamKernels[static_cast<int32>(EGeoConversion::GeographicToECEF)];
+	const FProjPipelines Pipelines = { ProjProjectedToGeographic, ProjProjectedToECEF, ProjGeographicToECEF };
+	if (GeographicToECEFKernel == nullptr || Pipelines.GeographicToECEF == nullptr)
+	{
+		UE_LOG(LogGeoReferencing, Error, TEXT("Local frames grid can't be built without a valid Geographic CRS"));
+		return;
+	}
+
+	LocalFrameGridColumns = static_cast<int32>(Columns);
+	LocalFrameGridRows = static_cast<int32>(Rows);
+
+	// Cell centers converted in one batch, with the closed-form formulas of the ellipsoid when they were validated
+	TArray<FVector> ECEFOrigins;
+	ECEFOrigins.SetNumUninitialized(LocalFrameGridColumns * LocalFrameGridRows);
+	for (int32 CellId = 0; CellId < ECEFOrigins.Num(); ++CellId)
+	{
+		const FGeographicCoordinates Origin = GetLocalFrameCellCenter(CellId);
+		ECEFOrigins[CellId] = FVector(Origin.Longitude, Origin.Latitude, Origin.Altitude);
+	}
+	const FGeoCoordinateStreams Streams = FGeoCoordinateStreams::Make(MakeArrayView(ECEFOrigins));
+	for (int32 StartIndex = 0; StartIndex < Streams.Num; StartIndex += GeoReferencingBatchChunkSize)
+	{
+		GeographicToECEFKernel(StreamKernelConstants, Pipelines, Streams.Slice(StartIndex, FMath::Min(GeoReferencingBatchChunkSize, Streams.Num - StartIndex)));
+	}
+
+	LocalFrameCells.SetNumUninitialized(ECEFOrigins.Num());
+	for (int32 CellId = 0; CellId < LocalFrameCells.Num(); ++CellId)
+	{
+		LocalFrameCells[CellId] = GetWorldFrameToECEFFrame(GeographicEllipsoid, ECEFOrigins[CellId]);
+	}
+	LocalFrameGridSettings = Settings;
+}
+
+FGeographicCoordinates AGeoReferencingSystem::FGeoReferencingSystemInternals::GetLocalFrameCellCenter(int32 CellId) const
+{
+	const int32 Column = CellId % LocalFrameGridColumns;
+	const int32 Row = CellId / LocalFrameGridColumns;
+	return FGeographicCoordinates(
+		FRotator::NormalizeAxis(LocalFrameGridMinLongitude + (Column + 0.5) * LocalFrameGridCellSize),
+		FMath::Clamp(LocalFrameGridMinLatitude + (Row + 0.5) * LocalFrameGridCellSize, -90.0, 90.0),
+		0.0);
+}
+
+int32 AGeoReferencingSystem::FGeoReferencingSystemInternals::FindLocalFrameCell(double Longitude, double Latitude) const
+{
+	if (LocalFrameCells.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	// Longitudes wrap around, latitudes don't. Locations exactly on the max borders belong to the last cells.
+	const double LongitudeOffset = FMath::Fmod(Longitude - LocalFrameGridMinLongitude + 720.0, 360.0);
+	const int64 Column = FMath::FloorToInt64(LongitudeOffset / LocalFrameGridCellSize);
+	const int64 Row = FMath::FloorToInt64((Latitude - LocalFrameGridMinLatitude) / LocalFrameGridCellSize);
+	const int64 ClampedColumn = Column == LocalFrameGridColumns && LongitudeOffset <= LocalFrameGridColumns * LocalFrameGridCellSize ? Column - 1 : Column;
+	const int64 ClampedRow = Row == LocalFrameGridRows && Latitude <= LocalFrameGridMinLatitude + LocalFrameGridRows * LocalFrameGridCellSize ? Row - 1 : Row;
+	if (ClampedColumn < 0 || ClampedColumn >= LocalFrameGridColumns || ClampedRow < 0 || ClampedRow >= LocalFrameGridRows)
+	{
+		return INDEX_NONE;
+	}
+	return static_cast<int32>(ClampedRow * LocalFrameGridColumns + ClampedColumn);
+}
+
+FVector AGeoReferencingSystem::FGeoReferencingSystemInternals::ECEFToLocalFrame(int32 CellId, const FVector& ECEFCoordinates) const
+{
+	// The frame is orthonormal : its inverse rotation is the transpose, applied as dot products with the axes
+	const FMatrix& Frame = LocalFrameCells[CellId];
+	const FVector Offset = ECEFCoordinates - Frame.GetOrigin();
+	return FVector(
+		100.0 * (Offset | Frame.GetScaledAxis(EAxis::X)),
+		-100.0 * (Offset | Frame.GetScaledAxis(EAxis::Y)),
+		100.0 * (Offset | Frame.GetScaledAxis(EAxis::Z)));
+}
+
+FVector AGeoReferencingSystem::FGeoReferencingSystemInternals::LocalFrameToECEF(int32 CellId, const FVector& LocalCoordinates) const
+{
+	return LocalFrameCells[CellId].TransformPosition(LocalCoordinates * FVector(0.01, -0.01, 0.01));
+}
+
+int32 AGeoReferencingSystem::GetLocalFrameCellId(const FGeographicCoordinates& GeographicCoordinates) const
+{
+	Impl->WaitForInitialization();
+	return Impl->FindLocalFrameCell(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude);
+}
+
+bool AGeoReferencingSystem::GetLocalFrameCellOrigin(int32 CellId, FGeographicCoordinates& GeographicCoordinates) const
+{
+	Impl->WaitForInitialization();
+	if (!Impl->LocalFrameCells.IsValidIndex(CellId))
+	{
+		return false;
+	}
+
+	GeographicCoordinates = Impl->GetLocalFrameCellCenter(CellId);
+	return true;
+}
+
+bool AGeoReferencingSystem::GeographicToLocalFrame(const FGeographicCoordinates& GeographicCoordinates, FGeoLocalFrameCoordinates& LocalFrameCoordinates)
+{
+	LocalFrameCoordinates.CellId = GetLocalFrameCellId(GeographicCoordinates);
+	if (LocalFrameCoordinates.CellId == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FVector ECEFCoordinates;
+	GeographicToECEF(GeographicCoordinates, ECEFCoordinates);
+	LocalFrameCoordinates.LocalCoordinates = Impl->ECEFToLocalFrame(LocalFrameCoordinates.CellId, ECEFCoordinates);
+	return true;
+}
+
+bool AGeoReferencingSystem::ECEFToLocalFrame(const FVector& ECEFCoordinates, FGeoLocalFrameCoordinates& LocalFrameCoordinates)
+{
+	Impl->WaitForInitialization();
+
+	const FGeographicCoordinates GeographicCoordinates = Impl->GeographicEllipsoid.ECEFToGeographic(ECEFCoordinates);
+	LocalFrameCoordinates.CellId = Impl->FindLocalFrameCell(GeographicCoordinates.Longitude, GeographicCoordinates.Latitude);
+	if (LocalFrameCoordinates.CellId == INDEX_NONE)
+	{
+		return false;
+	}
+
+	LocalFrameCoordinates.LocalCoordinates = Impl->ECEFToLocalFrame(LocalFrameCoordinates.CellId, ECEFCoordinates);
+	return true;
+}
+
+bool AGeoReferencingSystem::EngineToLocalFrame(const FVector& EngineCoordinates, FGeoLocalFrameCoordinates& LocalFrameCoordinates)
+{
+	FVector ECEFCoordinates;
+	EngineToECEF(EngineCoordinates, ECEFCoordinates);
+	return ECEFToLocalFrame(ECEFCoordinates, LocalFrameCoordinates);
+}
+
+bool AGeoReferencingSystem::LocalFrameToECEF(const FGeoLocalFrameCoordinates& LocalFrameCoordinates, FVector& ECEFCoordinates)
+{
+	Impl->WaitForInitialization();
+
+	if (!Impl->LocalFrameCells.IsValidIndex(LocalFrameCoordinates.CellId))
+	{
+		return false;
+	}
+
+	ECEFCoordinates = Impl->LocalFrameToECEF(LocalFrameCoordinates.CellId, LocalFrameCoordinates.LocalCoordinates);
+	return true;
+}
+
+bool AGeoReferencingSystem::LocalFrameToGeographic(const FGeoLocalFrameCoordinates& LocalFrameCoordinates, FGeographicCoordinates& GeographicCoordinates)
+{
+	FVector ECEFCoordinates;
+	if (!LocalFrameToECEF(LocalFrameCoordinates, ECEFCoordinates))
+	{
+		return false;
+	}
+
+	ECEFToGeographic(ECEFCoordinates, GeographicCoordinates);
+	return true;
+}
+
+bool AGeoReferencingSystem::LocalFrameToEngine(const FGeoLocalFrameCoordinates& LocalFrameCoordinates, FVector& EngineCoordinates)
+{
+	FVector ECEFCoordinates;
+	if (!LocalFrameToECEF(LocalFrameCoordinates, ECEFCoordinates))
+	{
+		return false;
+	}
+
+	ECEFToEngine(ECEFCoordinates, EngineCoordinates);
+	return true;
+}
+
+bool AGeoReferencingSystem::GetLocalFrameToLocalFrameTransform(int32 SourceCellId, int32 TargetCellId, FTransform& Transform)
+{
+	Impl->WaitForInitialization();
+
+	if (!Impl->LocalFrameCells.IsValidIndex(SourceCellId) || !Impl->LocalFrameCells.IsValidIndex(TargetCellId))
+	{
+		return false;
+	}
+
+	// UE units and Y flip on both sides, so that the result is a rigid transform in engine units
+	const FMatrix SourceToTarget = FScaleMatrix(FVector(0.01, -0.01, 0.01)) * Impl->LocalFrameCells[SourceCellId] * Impl->LocalFrameCells[TargetCellId].Inverse() * FScaleMatrix(FVector(100.0, -100.0, 100.0));
+	Transform = FTransform(SourceToTarget);
+	return true;
+}
+
+bool AGeoReferencingSystem::GetLocalFrameToEngineTransform(int32 CellId, FTransform& Transform)
+{
+	Impl->WaitForInitialization();
+
+	if (PlanetShape != EPlanetShape::RoundPlanet || !Impl->LocalFrameCells.IsValidIndex(CellId))
+	{
+		return false;
+	}
+
+	// ECEFFrameToWorldFrame is the identity when the origin is at the planet center
+	const FMatrix CellToEngine = FScaleMatrix(FVector(0.01, -0.01, 0.01)) * Impl->LocalFrameCells[CellId] * Impl->ECEFFrameToWorldFrame * FScaleMatrix(FVector(100.0, -100.0, 100.0));
+	Transform = FTransform(CellToEngine);
+	return true;
+}
+
 #if WITH_EDITOR
 void AGeoReferencingSystem::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -1384,7 +4472,19 @@ void AGeoReferencingSystem::PostEditChangeProperty(FPropertyChangedEvent& Proper
 		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, OriginProjectedCoordinatesEasting) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, OriginProjectedCoordinatesNorthing) ||
 		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, OriginProjectedCoordinatesUp) ||
-		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, PlanetShape))
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, PlanetShape) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, bUseNativeConversions) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, NativeConversionToleranceMeters) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, bUseCoordinateCache) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, CoordinateCacheSize) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, bUseProjectionFactorsCache) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, ProjectionFactorsCacheCellSize) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, bUseLocalFrameGrid) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, LocalFrameGridCellSizeDegrees) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, LocalFrameGridMinLongitude) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, LocalFrameGridMaxLongitude) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, LocalFrameGridMinLatitude) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(AGeoReferencingSystem, LocalFrameGridMaxLatitude))
 	{
 		ApplySettings();
 	}
@@ -1392,4 +4492,20 @@ void AGeoReferencingSystem::PostEditChangeProperty(FPropertyChangedEvent& Proper
 	// Call the base class version  
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
+
+void AGeoReferencingSystem::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	// Only cooked packages carry a resolved state, the editor always resolves the definitions
+	CookedState = FGeoReferencingCookedState();
+	if (ObjectSaveContext.IsCooking() && bCookResolvedState && !HasAnyFlags(RF_ClassDefaultObject))
+	{
+		Impl->WaitForInitialization();
+		if (!BuildCookedState(CookedState))
+		{
+			CookedState = FGeoReferencingCookedState();
+		}
+	}
+}
 #endif
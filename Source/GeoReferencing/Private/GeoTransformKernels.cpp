@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoTransformKernels.h"
+
+FGeoAffineTransform::FGeoAffineTransform()
+{
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			M[Row][Column] = (Row == Column) ? 1.0 : 0.0;
+		}
+	}
+}
+
+FGeoAffineTransform FGeoAffineTransform::MakeScaleThenMatrix(const FVector& Scale, const FMatrix& Matrix)
+{
+	// FMatrix uses the row vector convention : Out[j] = Sum_i In[i] * Matrix.M[i][j] + Matrix.M[3][j]
+	FGeoAffineTransform Transform;
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		for (int32 Column = 0; Column < 3; ++Column)
+		{
+			Transform.M[Row][Column] = Scale[Column] * Matrix.M[Column][Row];
+		}
+		Transform.M[Row][3] = Matrix.M[3][Row];
+	}
+	return Transform;
+}
+
+FGeoAffineTransform FGeoAffineTransform::MakeMatrixThenScale(const FMatrix& Matrix, const FVector& Scale)
+{
+	FGeoAffineTransform Transform;
+	for (int32 Row = 0; Row < 3; ++Row)
+	{
+		for (int32 Column = 0; Column < 3; ++Column)
+		{
+			Transform.M[Row][Column] = Scale[Row] * Matrix.M[Column][Row];
+		}
+		Transform.M[Row][3] = Scale[Row] * Matrix.M[3][Row];
+	}
+	return Transform;
+}
+
+FVector FGeoAffineTransform::TransformPosition(const FVector& Position) const
+{
+	FVector Result = Position;
+	TransformPositionsStrided(*this, &Result.X, &Result.Y, &Result.Z, sizeof(FVector), 1);
+	return Result;
+}
+
+namespace GeoTransformKernels
+{
+	// Scalar version of one output component. Each operation is a separate statement so that the compiler does not
+	// contract them into FMAs, which would break the bit-identity with the vector path.
+	static FORCEINLINE double TransformComponent(const double* Row, double X, double Y, double Z)
+	{
+		double Result = Row[0] * X;
+		const double TermY = Row[1] * Y;
+		Result = Result + TermY;
+		const double TermZ = Row[2] * Z;
+		Result = Result + TermZ;
+		Result = Result + Row[3];
+		return Result;
+	}
+
+	static FORCEINLINE VectorRegister4Double TransformComponent(const VectorRegister4Double* Row, const VectorRegister4Double& X, const VectorRegister4Double& Y, const VectorRegister4Double& Z)
+	{
+		VectorRegister4Double Result = VectorMultiply(Row[0], X);
+		Result = VectorAdd(Result, VectorMultiply(Row[1], Y));
+		Result = VectorAdd(Result, VectorMultiply(Row[2], Z));
+		Result = VectorAdd(Result, Row[3]);
+		return Result;
+	}
+
+	void TransformPositions(const FGeoAffineTransform& Transform, const double* InX, const double* InY, const double* InZ, double* OutX, double* OutY, double* OutZ, int32 Num)
+	{
+		// Broadcast the 12 coefficients once
+		VectorRegister4Double Rows[3][4];
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				Rows[Row][Column] = VectorSetFloat1(Transform.M[Row][Column]);
+			}
+		}
+
+		int32 Index = 0;
+		for (; Index + 4 <= Num; Index += 4)
+		{
+			// Load everything before storing, since In and Out may alias
+			const VectorRegister4Double X = VectorLoad(InX + Index);
+			const VectorRegister4Double Y = VectorLoad(InY + Index);
+			const VectorRegister4Double Z = VectorLoad(InZ + Index);
+
+			VectorStore(TransformComponent(Rows[0], X, Y, Z), OutX + Index);
+			VectorStore(TransformComponent(Rows[1], X, Y, Z), OutY + Index);
+			VectorStore(TransformComponent(Rows[2], X, Y, Z), OutZ + Index);
+		}
+
+		for (; Index < Num; ++Index)
+		{
+			const double X = InX[Index];
+			const double Y = InY[Index];
+			const double Z = InZ[Index];
+
+			OutX[Index] = TransformComponent(Transform.M[0], X, Y, Z);
+			OutY[Index] = TransformComponent(Transform.M[1], X, Y, Z);
+			OutZ[Index] = TransformComponent(Transform.M[2], X, Y, Z);
+		}
+	}
+
+	void TransformPositionsStrided(const FGeoAffineTransform& Transform, double* X, double* Y, double* Z, SIZE_T Stride, int32 Num)
+	{
+		uint8* XBytes = reinterpret_cast<uint8*>(X);
+		uint8* YBytes = reinterpret_cast<uint8*>(Y);
+		uint8* ZBytes = reinterpret_cast<uint8*>(Z);
+
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			double& OutX = *reinterpret_cast<double*>(XBytes + Index * Stride);
+			double& OutY = *reinterpret_cast<double*>(YBytes + Index * Stride);
+			double& OutZ = *reinterpret_cast<double*>(ZBytes + Index * Stride);
+			const double InX = OutX;
+			const double InY = OutY;
+			const double InZ = OutZ;
+
+			OutX = TransformComponent(Transform.M[0], InX, InY, InZ);
+			OutY = TransformComponent(Transform.M[1], InX, InY, InZ);
+			OutZ = TransformComponent(Transform.M[2], InX, InY, InZ);
+		}
+	}
+
+	void TransformPositions(const FGeoAffineTransform& Transform, const FGeoCoordinateStreams& Streams)
+	{
+		if (Streams.Stride == sizeof(double))
+		{
+			TransformPositions(Transform, Streams.X, Streams.Y, Streams.Z, Streams.X, Streams.Y, Streams.Z, Streams.Num);
+		}
+		else
+		{
+			TransformPositionsStrided(Transform, Streams.X, Streams.Y, Streams.Z, Streams.Stride, Streams.Num);
+		}
+	}
+}
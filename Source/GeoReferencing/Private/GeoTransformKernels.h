@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GeoCoordinateBuffer.h"
+
+/**
+ * Affine transform of positions, stored as the 3x4 coefficients applied to (X, Y, Z, 1) :
+ *    Out.X = M[0][0] * In.X + M[0][1] * In.Y + M[0][2] * In.Z + M[0][3]    (and so on for Y and Z)
+ * Used to fuse the UE units conversion, the Y flip and the frame matrices in a single pass.
+ */
+struct FGeoAffineTransform
+{
+	double M[3][4];
+
+	FGeoAffineTransform();
+
+	/** Transform equivalent to Matrix.TransformPosition(Position * Scale) */
+	static FGeoAffineTransform MakeScaleThenMatrix(const FVector& Scale, const FMatrix& Matrix);
+
+	/** Transform equivalent to Matrix.TransformPosition(Position) * Scale */
+	static FGeoAffineTransform MakeMatrixThenScale(const FMatrix& Matrix, const FVector& Scale);
+
+	FVector TransformPosition(const FVector& Position) const;
+};
+
+namespace GeoTransformKernels
+{
+	/**
+	 * Transform positions stored as separate X, Y and Z arrays (structure of arrays). In and Out arrays may be the same.
+	 * Runs 4 points per iteration with VectorRegister4Double (one AVX register, or two SSE/NEON registers), then a scalar tail.
+	 */
+	void TransformPositions(const FGeoAffineTransform& Transform, const double* InX, const double* InY, const double* InZ, double* OutX, double* OutY, double* OutZ, int32 Num);
+
+	/**
+	 * Transform positions in place, accessed through a byte stride (e.g. the X, Y and Z members of an FVector array).
+	 * Uses the same operations in the same order as TransformPositions, so results are bit-identical.
+	 */
+	void TransformPositionsStrided(const FGeoAffineTransform& Transform, double* X, double* Y, double* Z, SIZE_T Stride, int32 Num);
+
+	/** Transform streams in place, with the SIMD kernel when they are contiguous arrays, or the strided one otherwise */
+	void TransformPositions(const FGeoAffineTransform& Transform, const FGeoCoordinateStreams& Streams);
+}
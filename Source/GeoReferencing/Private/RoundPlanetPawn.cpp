@@ -5,6 +5,7 @@
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
 #include "GeoReferencingSystem.h"
+#include "GeoReferencingSubsystem.h"
 #include "GameFramework/FloatingPawnMovement.h"
 #include "GameFramework/PlayerInput.h"
 #include "GameFramework/Controller.h"
@@ -170,7 +171,11 @@ void ARoundPlanetPawn::OnConstruction(const FTransform& Transform)
 	Super::OnConstruction(Transform);
 	if (!GeoReferencingSystem)
 	{
-		GeoReferencingSystem = AGeoReferencingSystem::GetGeoReferencingSystem(GetWorld());
+		// Construction scripts run again on every edit, don't log there. BeginPlay reports a missing or duplicated system.
+		if (UGeoReferencingSubsystem* Subsystem = UGeoReferencingSubsystem::Get(this))
+		{
+			GeoReferencingSystem = Subsystem->GetCachedGeoReferencingSystem();
+		}
 	}
 }
 
@@ -0,0 +1,213 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "GeoBatchTask.h"
+#include "GeoCoordinateBuffer.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GeoReferencingAsyncBatchTest
+{
+	TSharedRef<FGeoCoordinateBuffer> MakeGeographicBuffer(int32 NumPoints)
+	{
+		TSharedRef<FGeoCoordinateBuffer> Buffer = MakeShared<FGeoCoordinateBuffer>();
+		Buffer->CopyFrom(FGeoReferencingTestWorld::MakeGeographicLocations(NumPoints));
+		return Buffer;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingAsyncBatchCompletionTest, "Plugins.GeoReferencing.Async.Completion",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingAsyncBatchCompletionTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingAsyncBatchTest;
+
+	for (EPlanetShape PlanetShape : { EPlanetShape::FlatPlanet, EPlanetShape::RoundPlanet })
+	{
+		FGeoReferencingTestWorld TestWorld(PlanetShape);
+		AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+		if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+		{
+			return false;
+		}
+
+		// Not a multiple of the step size, the last step is partial
+		const int32 NumPoints = 100000;
+		TSharedRef<FGeoCoordinateBuffer> Coordinates = MakeGeographicBuffer(NumPoints);
+		FGeoCoordinateBuffer Expected = *Coordinates;
+		GeoReferencingSystem->TransformBatch(EGeoConversion::GeographicToEngine, Expected);
+
+		TSharedPtr<FGeoBatchTaskHandle> Task = MakeShared<FGeoBatchTaskHandle>();
+		TFuture<bool> Future = GeoReferencingSystem->TransformBatchAsync(EGeoConversion::GeographicToEngine, Coordinates, Task);
+		if (!TestTrue(TEXT("Asynchronous batch completed"), Future.Get()))
+		{
+			return false;
+		}
+		TestEqual(TEXT("Converted coordinates"), Task->GetNumConverted(), NumPoints);
+		TestEqual(TEXT("Progress"), Task->GetProgress(), 1.0f);
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			NumMismatches += Coordinates->GetVector(Index).Equals(Expected.GetVector(Index), 1e-6) ? 0 : 1;
+		}
+		TestEqual(FString::Printf(TEXT("%s : coordinates different from TransformBatch"), *UEnum::GetValueAsString(PlanetShape)), NumMismatches, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingAsyncBatchDelegateTest, "Plugins.GeoReferencing.Async.CompletionDelegate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingAsyncBatchDelegateTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingAsyncBatchTest;
+
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::RoundPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	const int32 NumPoints = 100000;
+	TSharedRef<FGeoCoordinateBuffer> Coordinates = MakeGeographicBuffer(NumPoints);
+	FGeoCoordinateBuffer Expected = *Coordinates;
+	GeoReferencingSystem->TransformBatch(EGeoConversion::GeographicToEngine, Expected);
+
+	int32 NumCalls = 0;
+	bool bSucceeded = false;
+	bool bCalledOnGameThread = false;
+	TSharedRef<FGeoBatchTaskHandle> Task = GeoReferencingSystem->TransformBatchAsync(EGeoConversion::GeographicToEngine, Coordinates,
+		FOnGeoBatchCompleted::CreateLambda([&NumCalls, &bSucceeded, &bCalledOnGameThread](bool bSuccess)
+		{
+			++NumCalls;
+			bSucceeded = bSuccess;
+			bCalledOnGameThread = IsInGameThread();
+		}));
+	TestEqual(TEXT("Coordinates to convert"), Task->GetNumCoordinates(), NumPoints);
+
+	// The delegate is dispatched to the game thread : process its tasks until it is called
+	const double TimeoutSeconds = FPlatformTime::Seconds() + 60.0;
+	while (NumCalls == 0 && FPlatformTime::Seconds() < TimeoutSeconds)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FPlatformProcess::Sleep(0.001f);
+	}
+	if (!TestEqual(TEXT("Delegate called once"), NumCalls, 1))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Delegate called on the game thread"), bCalledOnGameThread);
+	TestTrue(TEXT("Asynchronous batch completed"), bSucceeded);
+	TestEqual(TEXT("Converted coordinates"), Task->GetNumConverted(), NumPoints);
+
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		NumMismatches += Coordinates->GetVector(Index).Equals(Expected.GetVector(Index), 1e-6) ? 0 : 1;
+	}
+	TestEqual(TEXT("Coordinates different from TransformBatch"), NumMismatches, 0);
+
+	// No more call once the batch is over
+	FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	TestEqual(TEXT("Delegate called once after completion"), NumCalls, 1);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingAsyncBatchProgressTest, "Plugins.GeoReferencing.Async.Progress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingAsyncBatchProgressTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingAsyncBatchTest;
+
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::FlatPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	const int32 NumPoints = 2000000;
+	TSharedPtr<FGeoBatchTaskHandle> Task = MakeShared<FGeoBatchTaskHandle>();
+	TFuture<bool> Future = GeoReferencingSystem->TransformBatchAsync(EGeoConversion::GeographicToEngine, MakeGeographicBuffer(NumPoints), Task);
+	TestEqual(TEXT("Coordinates to convert"), Task->GetNumCoordinates(), NumPoints);
+
+	// The progress is updated step by step by the task : it never goes back, nor beyond 1
+	float LastProgress = 0.0f;
+	int32 NumSteps = 0;
+	while (!Future.IsReady())
+	{
+		const float Progress = Task->GetProgress();
+		if (Progress < LastProgress || Progress > 1.0f)
+		{
+			AddError(FString::Printf(TEXT("Progress went from %f to %f"), LastProgress, Progress));
+			break;
+		}
+		NumSteps += Progress > LastProgress ? 1 : 0;
+		LastProgress = Progress;
+		FPlatformProcess::Sleep(0.0f);
+	}
+	AddInfo(FString::Printf(TEXT("%d progress updates observed"), NumSteps));
+
+	TestTrue(TEXT("Asynchronous batch completed"), Future.Get());
+	TestEqual(TEXT("Converted coordinates"), Task->GetNumConverted(), NumPoints);
+	TestEqual(TEXT("Final progress"), Task->GetProgress(), 1.0f);
+	TestEqual(TEXT("Progress of the running batches"), GeoReferencingSystem->GetAsyncBatchesProgress(), 1.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingAsyncBatchCancellationTest, "Plugins.GeoReferencing.Async.CancelledByApplySettings",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingAsyncBatchCancellationTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingAsyncBatchTest;
+
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::FlatPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	const int32 NumPoints = 2000000;
+	TSharedPtr<FGeoBatchTaskHandle> Task = MakeShared<FGeoBatchTaskHandle>();
+	TFuture<bool> Future = GeoReferencingSystem->TransformBatchAsync(EGeoConversion::GeographicToEngine, MakeGeographicBuffer(NumPoints), Task);
+
+	// ApplySettings cancels the running batches and waits for them before changing the transforms
+	GeoReferencingSystem->PlanetShape = EPlanetShape::RoundPlanet;
+	GeoReferencingSystem->ApplySettings();
+	if (!TestTrue(TEXT("Batch finished when ApplySettings returns"), Future.IsReady()))
+	{
+		return false;
+	}
+
+	if (Future.Get())
+	{
+		// The whole batch was converted before the cancellation request was seen
+		AddInfo(TEXT("The batch completed before ApplySettings cancelled it"));
+		TestEqual(TEXT("Converted coordinates"), Task->GetNumConverted(), NumPoints);
+	}
+	else
+	{
+		TestTrue(TEXT("Cancellation requested"), Task->IsCancelRequested());
+		TestTrue(TEXT("Batch stopped before its end"), Task->GetNumConverted() < NumPoints);
+	}
+
+	// Batches started with the new settings are not affected
+	TSharedPtr<FGeoBatchTaskHandle> NextTask = MakeShared<FGeoBatchTaskHandle>();
+	TFuture<bool> NextFuture = GeoReferencingSystem->TransformBatchAsync(EGeoConversion::GeographicToEngine, MakeGeographicBuffer(1000), NextTask);
+	TestTrue(TEXT("Batch started after ApplySettings completed"), NextFuture.Get());
+	TestEqual(TEXT("Converted coordinates after ApplySettings"), NextTask->GetNumConverted(), 1000);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "GeoCoordinateBuffer.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GeoReferencingBenchmarkTest
+{
+	// Reduced version of the GeoReferencingBenchmark commandlet : one batch size, one run
+	constexpr int32 NumPoints = 10000;
+
+	// Conversion bringing the synthetic geographic points to the source space of Conversion, Count if they already are in it
+	EGeoConversion GetConversionToSource(EGeoConversion Conversion)
+	{
+		switch (Conversion)
+		{
+		case EGeoConversion::EngineToProjected:
+		case EGeoConversion::EngineToGeographic:
+		case EGeoConversion::EngineToECEF:
+			return EGeoConversion::GeographicToEngine;
+		case EGeoConversion::ProjectedToEngine:
+		case EGeoConversion::ProjectedToGeographic:
+		case EGeoConversion::ProjectedToECEF:
+			return EGeoConversion::GeographicToProjected;
+		case EGeoConversion::ECEFToEngine:
+		case EGeoConversion::ECEFToProjected:
+		case EGeoConversion::ECEFToGeographic:
+			return EGeoConversion::GeographicToECEF;
+		default:
+			return EGeoConversion::Count;
+		}
+	}
+
+	// The conversions are declared in pairs, each one followed by its inverse
+	EGeoConversion GetInverseConversion(EGeoConversion Conversion)
+	{
+		return static_cast<EGeoConversion>(static_cast<uint8>(Conversion) ^ 1);
+	}
+
+	// About 1 cm in the source space : degrees for geographic coordinates, centimeters for engine ones, meters otherwise
+	double GetRoundTripTolerance(EGeoConversion Conversion)
+	{
+		switch (GetConversionToSource(Conversion))
+		{
+		case EGeoConversion::Count: return 1e-7;
+		case EGeoConversion::GeographicToEngine: return 1.0;
+		default: return 0.01;
+		}
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGeoReferencingBenchmarkTest, "Plugins.GeoReferencing.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FGeoReferencingBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (EPlanetShape PlanetShape : { EPlanetShape::FlatPlanet, EPlanetShape::RoundPlanet })
+	{
+		for (EGeoConversion Conversion : TEnumRange<EGeoConversion>())
+		{
+			const FString PlanetShapeName = StaticEnum<EPlanetShape>()->GetNameStringByValue(static_cast<int64>(PlanetShape));
+			const FString ConversionName = StaticEnum<EGeoConversion>()->GetNameStringByValue(static_cast<int64>(Conversion));
+			OutBeautifiedNames.Add(PlanetShapeName + TEXT(".") + ConversionName);
+			OutTestCommands.Add(PlanetShapeName + TEXT(" ") + ConversionName);
+		}
+	}
+}
+
+bool FGeoReferencingBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingBenchmarkTest;
+
+	FString PlanetShapeName, ConversionName;
+	if (!Parameters.Split(TEXT(" "), &PlanetShapeName, &ConversionName))
+	{
+		AddError(FString::Printf(TEXT("Invalid test parameters '%s'"), *Parameters));
+		return false;
+	}
+	const EPlanetShape PlanetShape = static_cast<EPlanetShape>(StaticEnum<EPlanetShape>()->GetValueByNameString(PlanetShapeName));
+	const EGeoConversion Conversion = static_cast<EGeoConversion>(StaticEnum<EGeoConversion>()->GetValueByNameString(ConversionName));
+
+	FGeoReferencingTestWorld TestWorld(PlanetShape);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	FGeoCoordinateBuffer Source;
+	Source.CopyFrom(FGeoReferencingTestWorld::MakeGeographicLocations(NumPoints));
+	const EGeoConversion ToSource = GetConversionToSource(Conversion);
+	if (ToSource != EGeoConversion::Count)
+	{
+		GeoReferencingSystem->TransformBatch(ToSource, Source);
+	}
+
+	FGeoCoordinateBuffer Work = Source;
+	const double StartTime = FPlatformTime::Seconds();
+	GeoReferencingSystem->TransformBatch(Conversion, Work);
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+	AddInfo(FString::Printf(TEXT("%s %s : %.0f points/s"), *PlanetShapeName, *ConversionName, Seconds > 0.0 ? NumPoints / Seconds : 0.0));
+
+	// A kernel missing or skipping points would leave them unchanged or not finite, and break the round trip
+	GeoReferencingSystem->TransformBatch(GetInverseConversion(Conversion), Work);
+	const double Tolerance = GetRoundTripTolerance(Conversion);
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		if (!Work.GetVector(Index).Equals(Source.GetVector(Index), Tolerance))
+		{
+			if (NumMismatches++ == 0)
+			{
+				AddError(FString::Printf(TEXT("Coordinate %d came back as %s instead of %s"), Index, *Work.GetVector(Index).ToString(), *Source.GetVector(Index).ToString()));
+			}
+		}
+	}
+	return TestEqual(TEXT("Round trip mismatches"), NumMismatches, 0);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingCoordinateCacheSettingsChangeTest, "Plugins.GeoReferencing.CoordinateCache.SettingsChange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingCoordinateCacheSettingsChangeTest::RunTest(const FString& Parameters)
+{
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::FlatPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	GeoReferencingSystem->bUseCoordinateCache = true;
+	GeoReferencingSystem->ApplySettings();
+	GeoReferencingSystem->ResetPerformanceStats();
+
+	// Second conversion of the same location : found in the cache
+	const FGeographicCoordinates Location(3.0, 45.0, 100.0);
+	FVector First;
+	FVector Second;
+	GeoReferencingSystem->GeographicToEngine(Location, First);
+	GeoReferencingSystem->GeographicToEngine(Location, Second);
+	FGeoReferencingStats Stats = GeoReferencingSystem->GetPerformanceStats();
+	TestEqual(TEXT("Misses before ApplySettings"), Stats.CacheMisses, 1);
+	TestEqual(TEXT("Hits before ApplySettings"), Stats.CacheHits, 1);
+	TestEqual(TEXT("Cached result"), Second, First);
+
+	// Another origin, 1 km east : the cached result must not be returned
+	GeoReferencingSystem->OriginProjectedCoordinatesEasting += 1000.0;
+	GeoReferencingSystem->ApplySettings();
+
+	FVector AfterApplySettings;
+	GeoReferencingSystem->GeographicToEngine(Location, AfterApplySettings);
+	Stats = GeoReferencingSystem->GetPerformanceStats();
+	TestEqual(TEXT("Miss after ApplySettings"), Stats.CacheMisses, 2);
+	TestEqual(TEXT("No hit after ApplySettings"), Stats.CacheHits, 1);
+	TestFalse(TEXT("Result of the previous origin"), AfterApplySettings.Equals(First, 1.0));
+	TestTrue(FString::Printf(TEXT("Result moved by the origin shift, %s from %s"), *AfterApplySettings.ToString(), *First.ToString()), AfterApplySettings.Equals(First - FVector(100000.0, 0.0, 0.0), 0.01));
+
+	// Same for the inverse conversion
+	FGeographicCoordinates Geographic;
+	GeoReferencingSystem->EngineToGeographic(FVector::ZeroVector, Geographic);
+	GeoReferencingSystem->OriginProjectedCoordinatesEasting -= 1000.0;
+	GeoReferencingSystem->ApplySettings();
+
+	FGeographicCoordinates GeographicAfterApplySettings;
+	GeoReferencingSystem->EngineToGeographic(FVector::ZeroVector, GeographicAfterApplySettings);
+	TestTrue(FString::Printf(TEXT("Origin moved west, longitude %f from %f"), GeographicAfterApplySettings.Longitude, Geographic.Longitude), GeographicAfterApplySettings.Longitude < Geographic.Longitude - 0.005);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "GeoLocalLinearization.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingLinearizationSettingsChangeTest, "Plugins.GeoReferencing.Linearization.SettingsChange",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingLinearizationSettingsChangeTest::RunTest(const FString& Parameters)
+{
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::FlatPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	FGeoLocalLinearization Linearization(GeoReferencingSystem, EGeoConversion::GeographicToEngine);
+	const FVector Location(3.0, 45.0, 100.0);
+	FVector Engine;
+	TestTrue(TEXT("First conversion"), Linearization.Transform(Location, Engine));
+	TestTrue(TEXT("Anchored"), Linearization.HasAnchor());
+	TestEqual(TEXT("Anchors"), Linearization.GetNumAnchors(), int64(1));
+
+	// Another origin : the anchor must not be reused
+	GeoReferencingSystem->OriginProjectedCoordinatesEasting += 1000.0;
+	GeoReferencingSystem->ApplySettings();
+
+	FVector Linearized;
+	TestTrue(TEXT("Conversion after ApplySettings"), Linearization.Transform(Location + FVector(0.00001, 0.0, 0.0), Linearized));
+	TestEqual(TEXT("Anchors after ApplySettings"), Linearization.GetNumAnchors(), int64(2));
+
+	FVector Exact;
+	GeoReferencingSystem->GeographicToEngine(FGeographicCoordinates(Location.X + 0.00001, Location.Y, Location.Z), Exact);
+	TestTrue(FString::Printf(TEXT("Conversion with the new origin, %s instead of %s"), *Linearized.ToString(), *Exact.ToString()), Linearized.Equals(Exact, 0.1));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
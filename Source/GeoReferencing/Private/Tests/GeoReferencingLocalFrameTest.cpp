@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingLocalFrameAntimeridianTest, "Plugins.GeoReferencing.LocalFrames.Antimeridian",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingLocalFrameAntimeridianTest::RunTest(const FString& Parameters)
+{
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::RoundPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	// 20 degrees of longitude across the antimeridian, in 1 degree cells
+	GeoReferencingSystem->bUseLocalFrameGrid = true;
+	GeoReferencingSystem->LocalFrameGridCellSizeDegrees = 1.0;
+	GeoReferencingSystem->LocalFrameGridMinLongitude = 170.0;
+	GeoReferencingSystem->LocalFrameGridMaxLongitude = -170.0;
+	GeoReferencingSystem->LocalFrameGridMinLatitude = -10.0;
+	GeoReferencingSystem->LocalFrameGridMaxLatitude = 10.0;
+	GeoReferencingSystem->ApplySettings();
+
+	const int32 EastCell = GeoReferencingSystem->GetLocalFrameCellId(FGeographicCoordinates(175.5, 0.5, 0.0));
+	const int32 WestCell = GeoReferencingSystem->GetLocalFrameCellId(FGeographicCoordinates(-175.5, 0.5, 0.0));
+	TestNotEqual(TEXT("Cell east of the antimeridian"), EastCell, int32(INDEX_NONE));
+	TestNotEqual(TEXT("Cell west of the antimeridian"), WestCell, int32(INDEX_NONE));
+	TestNotEqual(TEXT("Cells on both sides of the antimeridian"), EastCell, WestCell);
+	TestEqual(TEXT("Cell outside of the wrapped range"), GeoReferencingSystem->GetLocalFrameCellId(FGeographicCoordinates(0.0, 0.5, 0.0)), int32(INDEX_NONE));
+
+	// Cells are centered on their origin, and their frames hold exact local coordinates
+	for (const FGeographicCoordinates& Location : { FGeographicCoordinates(175.5, 0.5, 0.0), FGeographicCoordinates(-175.5, 0.5, 0.0), FGeographicCoordinates(179.9, -9.9, 1200.0) })
+	{
+		FGeoLocalFrameCoordinates LocalFrameCoordinates;
+		if (!TestTrue(TEXT("Location in the grid"), GeoReferencingSystem->GeographicToLocalFrame(Location, LocalFrameCoordinates)))
+		{
+			continue;
+		}
+
+		FGeographicCoordinates CellOrigin;
+		TestTrue(TEXT("Cell origin"), GeoReferencingSystem->GetLocalFrameCellOrigin(LocalFrameCoordinates.CellId, CellOrigin));
+		TestTrue(FString::Printf(TEXT("Cell origin %f is within half a cell of %f"), CellOrigin.Longitude, Location.Longitude), FMath::Abs(FRotator::NormalizeAxis(CellOrigin.Longitude - Location.Longitude)) <= 0.5);
+
+		FGeographicCoordinates RoundTrip;
+		TestTrue(TEXT("Local frame to geographic"), GeoReferencingSystem->LocalFrameToGeographic(LocalFrameCoordinates, RoundTrip));
+		TestEqual(TEXT("Round trip longitude"), FRotator::NormalizeAxis(RoundTrip.Longitude - Location.Longitude), 0.0, 1e-7);
+		TestEqual(TEXT("Round trip latitude"), RoundTrip.Latitude, Location.Latitude, 1e-7);
+		TestEqual(TEXT("Round trip altitude"), RoundTrip.Altitude, Location.Altitude, 1e-3);
+	}
+
+	// Reversed latitudes can't be wrapped : no grid is built
+	GeoReferencingSystem->LocalFrameGridMinLatitude = 10.0;
+	GeoReferencingSystem->LocalFrameGridMaxLatitude = -10.0;
+	AddExpectedError(TEXT("minimum latitude"), EAutomationExpectedErrorFlags::Contains, 1);
+	GeoReferencingSystem->ApplySettings();
+	TestEqual(TEXT("No grid with reversed latitudes"), GeoReferencingSystem->GetLocalFrameCellId(FGeographicCoordinates(175.5, 0.5, 0.0)), int32(INDEX_NONE));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
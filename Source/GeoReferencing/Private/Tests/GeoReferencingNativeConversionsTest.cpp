@@ -0,0 +1,220 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "Ellipsoid.h"
+#include "TransverseMercator.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GeoReferencingNativeConversionsTest
+{
+	// Geographic error expressed in meters on the ellipsoid, like the validation done by ApplySettings
+	double GeographicDistance(const FVector& A, const FVector& B, double Radius)
+	{
+		const double LatitudeError = FMathd::DegToRad * FMathd::Abs(A.Y - B.Y) * Radius;
+		const double LongitudeError = FMathd::DegToRad * FMathd::Abs(FRotator::NormalizeAxis(A.X - B.X)) * Radius * FMathd::Cos(FMathd::DegToRad * A.Y);
+		const double AltitudeError = FMathd::Abs(A.Z - B.Z);
+		return FMathd::Max3(LatitudeError, LongitudeError, AltitudeError);
+	}
+
+	FVector ToVector(const FGeographicCoordinates& Geographic)
+	{
+		return FVector(Geographic.Longitude, Geographic.Latitude, Geographic.Altitude);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingNativeTransverseMercatorTest, "Plugins.GeoReferencing.NativeConversions.TransverseMercator",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingNativeTransverseMercatorTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingNativeConversionsTest;
+
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::FlatPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	// UTM zone 31 North on WGS84, the default projected CRS
+	FTransverseMercator::FParameters ZoneParameters;
+	ZoneParameters.CentralMeridian = 3.0;
+	const FTransverseMercator TransverseMercator(ZoneParameters);
+	const double Tolerance = GeoReferencingSystem->NativeConversionToleranceMeters;
+
+	// Across the zone, on its edges (0 and 6 degrees) and just beyond them, from the south to the north limit of UTM
+	TArray<FVector> Geographic;
+	const double Latitudes[] = { -80.0, -45.0, -0.5, 0.0, 0.5, 30.0, 45.0, 60.0, 72.0, 84.0 };
+	const double Longitudes[] = { -0.5, -0.001, 0.0, 0.001, 0.5, 1.5, 2.999, 3.0, 3.001, 4.5, 5.5, 5.999, 6.0, 6.001, 6.5 };
+	for (double Latitude : Latitudes)
+	{
+		for (double Longitude : Longitudes)
+		{
+			Geographic.Emplace(Longitude, Latitude, 250.0);
+		}
+	}
+
+	// Forward
+	TArray<FVector> ProjProjected;
+	if (!TestTrue(TEXT("PROJ forward"), GeoReferencingSystem->TransformCoordinates(TEXT("EPSG:4326"), TEXT("EPSG:32631"), Geographic, ProjProjected)))
+	{
+		return false;
+	}
+
+	double MaxForwardError = 0.0;
+	for (int32 Index = 0; Index < Geographic.Num(); ++Index)
+	{
+		const FVector NativeProjected = TransverseMercator.GeographicToProjected(FGeographicCoordinates(Geographic[Index].X, Geographic[Index].Y, Geographic[Index].Z));
+		const double Error = FVector::Distance(NativeProjected, ProjProjected[Index]);
+		if (!(Error <= Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Forward at (%f, %f) : %s instead of %s, %g m apart"), Geographic[Index].X, Geographic[Index].Y, *NativeProjected.ToString(), *ProjProjected[Index].ToString(), Error));
+		}
+		MaxForwardError = FMathd::Max(MaxForwardError, Error);
+	}
+
+	// Inverse, from the same projected coordinates
+	TArray<FVector> ProjGeographic;
+	if (!TestTrue(TEXT("PROJ inverse"), GeoReferencingSystem->TransformCoordinates(TEXT("EPSG:32631"), TEXT("EPSG:4326"), ProjProjected, ProjGeographic)))
+	{
+		return false;
+	}
+
+	double MaxInverseError = 0.0;
+	for (int32 Index = 0; Index < ProjProjected.Num(); ++Index)
+	{
+		const FVector Native = ToVector(TransverseMercator.ProjectedToGeographic(ProjProjected[Index]));
+		const double Error = GeographicDistance(ProjGeographic[Index], Native, ZoneParameters.SemiMajorAxis);
+		if (!(Error <= Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Inverse at %s : %s instead of %s, %g m apart"), *ProjProjected[Index].ToString(), *Native.ToString(), *ProjGeographic[Index].ToString(), Error));
+		}
+		MaxInverseError = FMathd::Max(MaxInverseError, Error);
+	}
+
+	AddInfo(FString::Printf(TEXT("Maximum difference with PROJ : %g m forward, %g m inverse (tolerance %g m)"), MaxForwardError, MaxInverseError, Tolerance));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingNativeGeographicToECEFTest, "Plugins.GeoReferencing.NativeConversions.GeographicToECEF",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingNativeGeographicToECEFTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingNativeConversionsTest;
+
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::RoundPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+
+	// WGS84
+	const FEllipsoid Ellipsoid(6378137.0, 6378137.0, 6356752.314245179);
+	const double Tolerance = GeoReferencingSystem->NativeConversionToleranceMeters;
+
+	// At and around the poles, from the ground up to beyond the geostationary orbit
+	TArray<FVector> Geographic;
+	const double Latitudes[] = { -90.0, -89.99999, -89.9, -60.0, 0.0, 45.0, 89.9, 89.99999, 90.0 };
+	const double Longitudes[] = { -180.0, -45.0, 0.0, 3.0, 135.0 };
+	const double Altitudes[] = { -10000.0, 0.0, 8848.0, 400000.0, 36000000.0, 400000000.0 };
+	for (double Latitude : Latitudes)
+	{
+		for (double Longitude : Longitudes)
+		{
+			for (double Altitude : Altitudes)
+			{
+				Geographic.Emplace(Longitude, Latitude, Altitude);
+			}
+		}
+	}
+
+	// Close to the planet center, inside and around the evolute of the ellipsoid (about 43 km wide). PROJ's inverse is not meant for them :
+	// the native inverse is checked by converting its result back with the forward conversions, which are exact.
+	const TArray<FVector> CentralECEF = { FVector(10000.0, 5000.0, 20000.0), FVector(1000.0, -500.0, -3000.0), FVector(30000.0, 30000.0, 1000.0), FVector(-40000.0, 0.0, 100.0), FVector(5.0, 5.0, 50000.0), FVector(100000.0, -200000.0, -300000.0) };
+
+	// Forward
+	TArray<FVector> ProjECEF;
+	if (!TestTrue(TEXT("PROJ forward"), GeoReferencingSystem->TransformCoordinates(TEXT("EPSG:4979"), TEXT("EPSG:4978"), Geographic, ProjECEF)))
+	{
+		return false;
+	}
+
+	double MaxForwardError = 0.0;
+	for (int32 Index = 0; Index < Geographic.Num(); ++Index)
+	{
+		const FVector NativeECEF = Ellipsoid.GeographicToECEF(FGeographicCoordinates(Geographic[Index].X, Geographic[Index].Y, Geographic[Index].Z));
+		const double Error = FVector::Distance(NativeECEF, ProjECEF[Index]);
+		if (!(Error <= Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Forward at %s : %s instead of %s, %g m apart"), *Geographic[Index].ToString(), *NativeECEF.ToString(), *ProjECEF[Index].ToString(), Error));
+		}
+		MaxForwardError = FMathd::Max(MaxForwardError, Error);
+	}
+
+	// Inverse, compared with PROJ away from the center
+	TArray<FVector> ProjGeographic;
+	if (!TestTrue(TEXT("PROJ inverse"), GeoReferencingSystem->TransformCoordinates(TEXT("EPSG:4978"), TEXT("EPSG:4979"), ProjECEF, ProjGeographic)))
+	{
+		return false;
+	}
+
+	double MaxInverseError = 0.0;
+	for (int32 Index = 0; Index < ProjECEF.Num(); ++Index)
+	{
+		const FVector Native = ToVector(Ellipsoid.ECEFToGeographic(ProjECEF[Index]));
+		const double Error = GeographicDistance(ProjGeographic[Index], Native, Ellipsoid.Radii.X);
+		if (!(Error <= Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Inverse at %s : %s instead of %s, %g m apart"), *ProjECEF[Index].ToString(), *Native.ToString(), *ProjGeographic[Index].ToString(), Error));
+		}
+		MaxInverseError = FMathd::Max(MaxInverseError, Error);
+	}
+
+	// Inverse, checked by converting its result back with PROJ : this also holds close to the center
+	TArray<FVector> ECEF = ProjECEF;
+	ECEF.Append(CentralECEF);
+	TArray<FVector> NativeGeographic;
+	for (const FVector& Location : ECEF)
+	{
+		NativeGeographic.Add(ToVector(Ellipsoid.ECEFToGeographic(Location)));
+	}
+
+	TArray<FVector> ProjRoundTrip;
+	if (!TestTrue(TEXT("PROJ forward of the native inverse"), GeoReferencingSystem->TransformCoordinates(TEXT("EPSG:4979"), TEXT("EPSG:4978"), NativeGeographic, ProjRoundTrip)))
+	{
+		return false;
+	}
+
+	double MaxRoundTripError = 0.0;
+	for (int32 Index = 0; Index < ECEF.Num(); ++Index)
+	{
+		const FVector NativeRoundTrip = Ellipsoid.GeographicToECEF(FGeographicCoordinates(NativeGeographic[Index].X, NativeGeographic[Index].Y, NativeGeographic[Index].Z));
+		const double NativeError = FVector::Distance(NativeRoundTrip, ECEF[Index]);
+		const double ProjError = FVector::Distance(ProjRoundTrip[Index], ECEF[Index]);
+		if (!(NativeError <= Tolerance) || !(ProjError <= Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Round trip of %s through %s : %g m apart natively, %g m through PROJ"), *ECEF[Index].ToString(), *NativeGeographic[Index].ToString(), NativeError, ProjError));
+		}
+		MaxRoundTripError = FMathd::Max3(MaxRoundTripError, NativeError, ProjError);
+	}
+
+	// Geographic round trip, away from the center where the geodetic coordinates are unique
+	for (const FVector& Location : Geographic)
+	{
+		const FVector RoundTrip = ToVector(Ellipsoid.ECEFToGeographic(Ellipsoid.GeographicToECEF(FGeographicCoordinates(Location.X, Location.Y, Location.Z))));
+		const double Error = GeographicDistance(Location, RoundTrip, Ellipsoid.Radii.X);
+		if (!(Error <= Tolerance) && FMathd::Abs(Location.Y) < 90.0)
+		{
+			AddError(FString::Printf(TEXT("Geographic round trip of %s : %s, %g m apart"), *Location.ToString(), *RoundTrip.ToString(), Error));
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Maximum difference with PROJ : %g m forward, %g m inverse, %g m round trip (tolerance %g m)"), MaxForwardError, MaxInverseError, MaxRoundTripError, Tolerance));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
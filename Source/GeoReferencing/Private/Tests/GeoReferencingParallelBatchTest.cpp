@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingParallelBatchTest, "Plugins.GeoReferencing.Batch.ParallelMatchesSingleThreaded",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingParallelBatchTest::RunTest(const FString& Parameters)
+{
+	// Enough chunks per thread to interleave the workers, repeated to reuse the pooled contexts
+	const TArray<FGeographicCoordinates> Geographic = FGeoReferencingTestWorld::MakeGeographicLocations(100000);
+	const int32 NumThreadsToTest[] = { 2, 3, 8, 64 };
+	const int32 NumRepeats = 4;
+
+	for (EPlanetShape PlanetShape : { EPlanetShape::FlatPlanet, EPlanetShape::RoundPlanet })
+	{
+		FGeoReferencingTestWorld TestWorld(PlanetShape);
+		AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+		if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+		{
+			return false;
+		}
+
+		TArray<FVector> Expected;
+		GeoReferencingSystem->GeographicToEngineBatch(Geographic, Expected);
+
+		for (int32 NumThreads : NumThreadsToTest)
+		{
+			for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+			{
+				TArray<FVector> Engine;
+				GeoReferencingSystem->GeographicToEngineBatchParallel(Geographic, Engine, NumThreads);
+				if (!TestEqual(TEXT("Number of converted coordinates"), Engine.Num(), Expected.Num()))
+				{
+					return false;
+				}
+
+				// Same kernels and pipelines on every context : any difference comes from a context shared between workers
+				int32 NumMismatches = 0;
+				for (int32 Index = 0; Index < Engine.Num(); ++Index)
+				{
+					if (!Engine[Index].Equals(Expected[Index], 1e-6))
+					{
+						if (NumMismatches++ == 0)
+						{
+							AddError(FString::Printf(TEXT("%s, %d threads : coordinate %d is %s instead of %s"), *UEnum::GetValueAsString(PlanetShape), NumThreads, Index, *Engine[Index].ToString(), *Expected[Index].ToString()));
+						}
+					}
+				}
+				TestEqual(FString::Printf(TEXT("%s, %d threads : mismatches"), *UEnum::GetValueAsString(PlanetShape), NumThreads), NumMismatches, 0);
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingProjectionFactorsCacheTest, "Plugins.GeoReferencing.ProjectionFactors.CacheError",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingProjectionFactorsCacheTest::RunTest(const FString& Parameters)
+{
+	FGeoReferencingTestWorld TestWorld(EPlanetShape::FlatPlanet);
+	AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+	if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+	{
+		return false;
+	}
+	TestFalse(TEXT("Cache disabled by default"), GeoReferencingSystem->bUseProjectionFactorsCache);
+
+	// The batch version never uses the cache
+	const TArray<FGeographicCoordinates> Locations = FGeoReferencingTestWorld::MakeGeographicLocations(1000);
+	TArray<FGeoProjectionFactors> ExactFactors;
+	if (!TestTrue(TEXT("Exact factors"), GeoReferencingSystem->GetProjectionFactorsBatch(Locations, ExactFactors)))
+	{
+		return false;
+	}
+
+	// Without the cache, the single location version is exact too
+	for (int32 Index = 0; Index < 10; ++Index)
+	{
+		FGeoProjectionFactors Factors;
+		TestTrue(TEXT("Uncached factors"), GeoReferencingSystem->GetProjectionFactors(Locations[Index], Factors));
+		TestEqual(TEXT("Uncached convergence"), Factors.MeridianConvergence, ExactFactors[Index].MeridianConvergence);
+		TestEqual(TEXT("Uncached scale"), Factors.MeridionalScale, ExactFactors[Index].MeridionalScale);
+	}
+
+	// With the default cell size (about 1 m), the factors of the cell center stay within the documented bound : 0.00001 degree of convergence.
+	// The scale varies by less than 1e-8 per meter in a UTM zone.
+	GeoReferencingSystem->bUseProjectionFactorsCache = true;
+	GeoReferencingSystem->ApplySettings();
+
+	double MaxConvergenceError = 0.0;
+	double MaxScaleError = 0.0;
+	for (int32 Index = 0; Index < Locations.Num(); ++Index)
+	{
+		// Twice, to get both the factors computed on a miss and the ones found on a hit
+		for (int32 Pass = 0; Pass < 2; ++Pass)
+		{
+			FGeoProjectionFactors Factors;
+			if (!TestTrue(TEXT("Cached factors"), GeoReferencingSystem->GetProjectionFactors(Locations[Index], Factors)))
+			{
+				return false;
+			}
+
+			const FGeoProjectionFactors& Exact = ExactFactors[Index];
+			MaxConvergenceError = FMath::Max(MaxConvergenceError, FMath::Abs(Factors.MeridianConvergence - Exact.MeridianConvergence));
+			MaxScaleError = FMath::Max3(MaxScaleError, FMath::Abs(Factors.MeridionalScale - Exact.MeridionalScale), FMath::Abs(Factors.ParallelScale - Exact.ParallelScale));
+		}
+	}
+
+	TestTrue(FString::Printf(TEXT("Convergence error %g degree"), MaxConvergenceError), MaxConvergenceError <= 0.00001);
+	TestTrue(FString::Printf(TEXT("Scale error %g"), MaxScaleError), MaxScaleError <= 1e-7);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "GeoCoordinateBuffer.h"
+#include "GeoStreamingTransform.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingStreamingTransformTest, "Plugins.GeoReferencing.Streaming.MemoryArchiveRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingStreamingTransformTest::RunTest(const FString& Parameters)
+{
+	// Several chunks, the last one partial, on two workers
+	const int32 NumPoints = 10000;
+	FGeoStreamingTransformSettings Settings;
+	Settings.ChunkSize = 4096;
+	Settings.NumWorkers = 2;
+
+	for (EPlanetShape PlanetShape : { EPlanetShape::FlatPlanet, EPlanetShape::RoundPlanet })
+	{
+		const FString PlanetShapeName = UEnum::GetValueAsString(PlanetShape);
+		FGeoReferencingTestWorld TestWorld(PlanetShape);
+		AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+		if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+		{
+			return false;
+		}
+
+		// Raw X, Y, Z doubles, geographic as Longitude, Latitude, Altitude
+		FGeoCoordinateBuffer Expected;
+		Expected.CopyFrom(FGeoReferencingTestWorld::MakeGeographicLocations(NumPoints));
+		TArray<FVector> Geographic;
+		Geographic.SetNumUninitialized(NumPoints);
+		Expected.CopyTo(Geographic);
+		GeoReferencingSystem->TransformBatch(EGeoConversion::GeographicToEngine, Expected);
+
+		TArray<uint8> GeographicBytes(reinterpret_cast<const uint8*>(Geographic.GetData()), NumPoints * sizeof(FVector));
+		TArray<uint8> EngineBytes;
+		TArray<uint8> RoundTripBytes;
+
+		// Streamed from a background thread, away from the game thread
+		const bool bSuccess = Async(EAsyncExecution::Thread, [&]()
+		{
+			FGeoStreamingTransformStats Stats;
+			FMemoryReader GeographicReader(GeographicBytes);
+			FMemoryWriter EngineWriter(EngineBytes);
+			if (!GeoReferencingSystem->TransformArchive(EGeoConversion::GeographicToEngine, GeographicReader, EngineWriter, Settings, Stats) || Stats.NumConverted != NumPoints)
+			{
+				return false;
+			}
+
+			FMemoryReader EngineReader(EngineBytes);
+			FMemoryWriter RoundTripWriter(RoundTripBytes);
+			return GeoReferencingSystem->TransformArchive(EGeoConversion::EngineToGeographic, EngineReader, RoundTripWriter, Settings, Stats) && Stats.NumConverted == NumPoints;
+		}).Get();
+		if (!TestTrue(FString::Printf(TEXT("%s : TransformArchive succeeded"), *PlanetShapeName), bSuccess)
+			|| !TestEqual(TEXT("Engine archive size"), EngineBytes.Num(), GeographicBytes.Num())
+			|| !TestEqual(TEXT("Round trip archive size"), RoundTripBytes.Num(), GeographicBytes.Num()))
+		{
+			return false;
+		}
+
+		const FVector* Engine = reinterpret_cast<const FVector*>(EngineBytes.GetData());
+		const FVector* RoundTrip = reinterpret_cast<const FVector*>(RoundTripBytes.GetData());
+		int32 NumEngineMismatches = 0;
+		int32 NumRoundTripMismatches = 0;
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			// Same kernels as the in memory batch, and about 1 cm back in degrees
+			NumEngineMismatches += Engine[Index].Equals(Expected.GetVector(Index), 1e-6) ? 0 : 1;
+			NumRoundTripMismatches += RoundTrip[Index].Equals(Geographic[Index], 1e-7) ? 0 : 1;
+		}
+		TestEqual(FString::Printf(TEXT("%s : streamed coordinates different from TransformBatch"), *PlanetShapeName), NumEngineMismatches, 0);
+		TestEqual(FString::Printf(TEXT("%s : round trip mismatches"), *PlanetShapeName), NumRoundTripMismatches, 0);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "GeoReferencingSystem.h"
+
+/**
+ * Transient world holding a GeoReferencingSystem with the default CRS (UTM zone 31 North on WGS84), for the automation tests.
+ * The world is destroyed with the object.
+ */
+class FGeoReferencingTestWorld
+{
+public:
+	explicit FGeoReferencingTestWorld(EPlanetShape PlanetShape)
+	{
+		World = UWorld::CreateWorld(EWorldType::Inactive, false);
+		GeoReferencingSystem = World->SpawnActor<AGeoReferencingSystem>();
+		if (GeoReferencingSystem != nullptr)
+		{
+			GeoReferencingSystem->PlanetShape = PlanetShape;
+			GeoReferencingSystem->ApplySettings();
+		}
+	}
+
+	~FGeoReferencingTestWorld()
+	{
+		World->DestroyWorld(false);
+	}
+
+	AGeoReferencingSystem* GetGeoReferencingSystem() const { return GeoReferencingSystem; }
+
+	// Locations spread over 2 x 2 degrees around the default origin (3 E, 45 N)
+	static TArray<FGeographicCoordinates> MakeGeographicLocations(int32 Num)
+	{
+		TArray<FGeographicCoordinates> Locations;
+		Locations.Reserve(Num);
+		FRandomStream Random(0x6e0);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Locations.Emplace(FMath::Lerp(2.0, 4.0, double(Random.GetFraction())), FMath::Lerp(44.0, 46.0, double(Random.GetFraction())), FMath::Lerp(-100.0, 4000.0, double(Random.GetFraction())));
+		}
+		return Locations;
+	}
+
+private:
+	UWorld* World = nullptr;
+	AGeoReferencingSystem* GeoReferencingSystem = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTestUtils.h"
+#include "GeoCoordinateBuffer.h"
+#include "GeoTransformKernels.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GeoReferencingTransformKernelsTest
+{
+	bool IsBitIdentical(const FVector& A, const FVector& B)
+	{
+		return FMemory::Memcmp(&A.X, &B.X, sizeof(double)) == 0 && FMemory::Memcmp(&A.Y, &B.Y, sizeof(double)) == 0 && FMemory::Memcmp(&A.Z, &B.Z, sizeof(double)) == 0;
+	}
+
+	TArray<FVector> MakeEngineLocations(int32 Num)
+	{
+		TArray<FVector> Locations;
+		Locations.Reserve(Num);
+		FRandomStream Random(0x6e1);
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			Locations.Emplace(Random.FRandRange(-1.0e8, 1.0e8), Random.FRandRange(-1.0e8, 1.0e8), Random.FRandRange(-1.0e6, 1.0e6));
+		}
+		return Locations;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingTransformKernelsBitIdenticalTest, "Plugins.GeoReferencing.TransformKernels.BitIdentical",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingTransformKernelsBitIdenticalTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingTransformKernelsTest;
+
+	// Engine to ECEF like, with an origin in the south of France
+	const FGeoAffineTransform Transform = FGeoAffineTransform::MakeScaleThenMatrix(FVector(0.01, -0.01, 0.01), FRotationTranslationMatrix(FRotator(-45.0, 93.0, 0.0), FVector(4199457.1, 220086.4, 4487348.4)));
+
+	// Counts that leave 0 to 3 points to the scalar tail
+	for (int32 Num : { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 13, 1021, 1024 })
+	{
+		const TArray<FVector> Locations = MakeEngineLocations(Num);
+
+		// Structure of arrays, SIMD then scalar tail, out of place and in place
+		TArray<double> X, Y, Z;
+		for (const FVector& Location : Locations)
+		{
+			X.Add(Location.X);
+			Y.Add(Location.Y);
+			Z.Add(Location.Z);
+		}
+		TArray<double> OutX, OutY, OutZ;
+		OutX.SetNumUninitialized(Num);
+		OutY.SetNumUninitialized(Num);
+		OutZ.SetNumUninitialized(Num);
+		GeoTransformKernels::TransformPositions(Transform, X.GetData(), Y.GetData(), Z.GetData(), OutX.GetData(), OutY.GetData(), OutZ.GetData(), Num);
+		GeoTransformKernels::TransformPositions(Transform, FGeoCoordinateStreams::Make(MakeArrayView(X), MakeArrayView(Y), MakeArrayView(Z)));
+
+		// Strided, through the FVector members
+		TArray<FVector> Strided = Locations;
+		GeoTransformKernels::TransformPositions(Transform, FGeoCoordinateStreams::Make(MakeArrayView(Strided)));
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			const FVector Scalar = Transform.TransformPosition(Locations[Index]);
+			NumMismatches += IsBitIdentical(FVector(OutX[Index], OutY[Index], OutZ[Index]), Scalar) ? 0 : 1;
+			NumMismatches += IsBitIdentical(FVector(X[Index], Y[Index], Z[Index]), Scalar) ? 0 : 1;
+			NumMismatches += IsBitIdentical(Strided[Index], Scalar) ? 0 : 1;
+		}
+		TestEqual(FString::Printf(TEXT("%d points : results different from the scalar path"), Num), NumMismatches, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGeoReferencingTransformKernelsSinglePointTest, "Plugins.GeoReferencing.TransformKernels.BatchMatchesSinglePoint",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGeoReferencingTransformKernelsSinglePointTest::RunTest(const FString& Parameters)
+{
+	using namespace GeoReferencingTransformKernelsTest;
+
+	struct FCase
+	{
+		EPlanetShape PlanetShape;
+		EGeoConversion Conversion;
+		void (AGeoReferencingSystem::*SinglePoint)(const FVector&, FVector&);
+	};
+	const FCase Cases[] =
+	{
+		{ EPlanetShape::RoundPlanet, EGeoConversion::EngineToECEF, &AGeoReferencingSystem::EngineToECEF },
+		{ EPlanetShape::RoundPlanet, EGeoConversion::ECEFToEngine, &AGeoReferencingSystem::ECEFToEngine },
+		{ EPlanetShape::FlatPlanet, EGeoConversion::EngineToProjected, &AGeoReferencingSystem::EngineToProjected },
+		{ EPlanetShape::FlatPlanet, EGeoConversion::ProjectedToEngine, &AGeoReferencingSystem::ProjectedToEngine },
+	};
+
+	for (const FCase& Case : Cases)
+	{
+		FGeoReferencingTestWorld TestWorld(Case.PlanetShape);
+		AGeoReferencingSystem* GeoReferencingSystem = TestWorld.GetGeoReferencingSystem();
+		if (!TestNotNull(TEXT("GeoReferencingSystem"), GeoReferencingSystem))
+		{
+			return false;
+		}
+
+		// Not a multiple of 4 : the scalar tail of the kernel is used too
+		const TArray<FVector> Locations = MakeEngineLocations(1023);
+
+		// Contiguous streams, converted by the SIMD kernel
+		FGeoCoordinateBuffer Buffer;
+		Buffer.CopyFrom(Locations);
+		GeoReferencingSystem->TransformBatch(Case.Conversion, Buffer);
+
+		// Strided streams
+		TArray<FVector> Batch = Locations;
+		GeoReferencingSystem->TransformBatch(Case.Conversion, FGeoCoordinateStreams::Make(MakeArrayView(Batch)));
+
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Locations.Num(); ++Index)
+		{
+			FVector SinglePoint;
+			(GeoReferencingSystem->*Case.SinglePoint)(Locations[Index], SinglePoint);
+			NumMismatches += IsBitIdentical(SinglePoint, Buffer.GetVector(Index)) ? 0 : 1;
+			NumMismatches += IsBitIdentical(SinglePoint, Batch[Index]) ? 0 : 1;
+		}
+		TestEqual(FString::Printf(TEXT("%s : batch results different from the single point ones"), *UEnum::GetValueAsString(Case.Conversion)), NumMismatches, 0);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TransverseMercator.h"
+#include "MathUtil.h"
+
+#include <cmath>
+
+FTransverseMercator::FTransverseMercator()
+	: FTransverseMercator(FParameters())
+{
+}
+
+FTransverseMercator::FTransverseMercator(const FParameters& InParameters)
+	: Parameters(InParameters)
+{
+	const double F = Parameters.Flattening;
+	const double N = F / (2.0 - F); // Third flattening
+	const double N2 = N * N;
+	const double N3 = N2 * N;
+	const double N4 = N3 * N;
+	const double N5 = N4 * N;
+	const double N6 = N5 * N;
+
+	EccentricitySquared = F * (2.0 - F);
+	Eccentricity = FMathd::Sqrt(EccentricitySquared);
+
+	const double RectifyingRadius = Parameters.SemiMajorAxis / (1.0 + N) * (1.0 + N2 / 4.0 + N4 / 64.0 + N6 / 256.0);
+	ScaledRectifyingRadius = Parameters.ScaleFactor * RectifyingRadius;
+
+	// Forward series
+	Alpha[0] = N / 2.0 - 2.0 * N2 / 3.0 + 5.0 * N3 / 16.0 + 41.0 * N4 / 180.0 - 127.0 * N5 / 288.0 + 7891.0 * N6 / 37800.0;
+	Alpha[1] = 13.0 * N2 / 48.0 - 3.0 * N3 / 5.0 + 557.0 * N4 / 1440.0 + 281.0 * N5 / 630.0 - 1983433.0 * N6 / 1935360.0;
+	Alpha[2] = 61.0 * N3 / 240.0 - 103.0 * N4 / 140.0 + 15061.0 * N5 / 26880.0 + 167603.0 * N6 / 181440.0;
+	Alpha[3] = 49561.0 * N4 / 161280.0 - 179.0 * N5 / 168.0 + 6601661.0 * N6 / 7257600.0;
+	Alpha[4] = 34729.0 * N5 / 80640.0 - 3418889.0 * N6 / 1995840.0;
+	Alpha[5] = 212378941.0 * N6 / 319334400.0;
+
+	// Inverse series
+	Beta[0] = N / 2.0 - 2.0 * N2 / 3.0 + 37.0 * N3 / 96.0 - N4 / 360.0 - 81.0 * N5 / 512.0 + 96199.0 * N6 / 604800.0;
+	Beta[1] = N2 / 48.0 + N3 / 15.0 - 437.0 * N4 / 1440.0 + 46.0 * N5 / 105.0 - 1118711.0 * N6 / 3870720.0;
+	Beta[2] = 17.0 * N3 / 480.0 - 37.0 * N4 / 840.0 - 209.0 * N5 / 4480.0 + 5569.0 * N6 / 90720.0;
+	Beta[3] = 4397.0 * N4 / 161280.0 - 11.0 * N5 / 504.0 - 830251.0 * N6 / 7257600.0;
+	Beta[4] = 4583.0 * N5 / 161280.0 - 108847.0 * N6 / 3991680.0;
+	Beta[5] = 20648693.0 * N6 / 638668800.0;
+
+	// Northing of the origin, on the central meridian
+	const double XiPrime0 = FMath::Atan(TauPrime(FMath::Tan(FMathd::DegToRad * Parameters.LatitudeOfOrigin)));
+	Xi0 = XiPrime0;
+	for (int32 j = 0; j < 6; ++j)
+	{
+		Xi0 += Alpha[j] * FMathd::Sin(2.0 * (j + 1) * XiPrime0);
+	}
+}
+
+double FTransverseMercator::TauPrime(double Tau) const
+{
+	const double Sigma = std::sinh(Eccentricity * std::atanh(Eccentricity * Tau / FMathd::Sqrt(1.0 + Tau * Tau)));
+	return Tau * FMathd::Sqrt(1.0 + Sigma * Sigma) - Sigma * FMathd::Sqrt(1.0 + Tau * Tau);
+}
+
+FVector FTransverseMercator::GeographicToProjected(const FGeographicCoordinates& GeographicCoordinates) const
+{
+	const double Lambda = FMathd::DegToRad * (GeographicCoordinates.Longitude - Parameters.CentralMeridian);
+	const double TauP = TauPrime(FMath::Tan(FMathd::DegToRad * GeographicCoordinates.Latitude));
+
+	double SinLambda, CosLambda;
+	FMath::SinCos(&SinLambda, &CosLambda, Lambda);
+
+	// Gauss-Schreiber (conformal sphere) coordinates
+	const double XiPrime = FMathd::Atan2(TauP, CosLambda);
+	const double EtaPrime = std::asinh(SinLambda / FMathd::Sqrt(TauP * TauP + CosLambda * CosLambda));
+
+	double Xi = XiPrime;
+	double Eta = EtaPrime;
+	for (int32 j = 0; j < 6; ++j)
+	{
+		const double K = 2.0 * (j + 1);
+		double SinXi, CosXi;
+		FMath::SinCos(&SinXi, &CosXi, K * XiPrime);
+		Xi += Alpha[j] * SinXi * std::cosh(K * EtaPrime);
+		Eta += Alpha[j] * CosXi * std::sinh(K * EtaPrime);
+	}
+
+	return FVector(
+		Parameters.FalseEasting + ScaledRectifyingRadius * Eta,
+		Parameters.FalseNorthing + ScaledRectifyingRadius * (Xi - Xi0),
+		GeographicCoordinates.Altitude);
+}
+
+FGeographicCoordinates FTransverseMercator::ProjectedToGeographic(const FVector& ProjectedCoordinates) const
+{
+	const double Xi = (ProjectedCoordinates.Y - Parameters.FalseNorthing) / ScaledRectifyingRadius + Xi0;
+	const double Eta = (ProjectedCoordinates.X - Parameters.FalseEasting) / ScaledRectifyingRadius;
+
+	double XiPrime = Xi;
+	double EtaPrime = Eta;
+	for (int32 j = 0; j < 6; ++j)
+	{
+		const double K = 2.0 * (j + 1);
+		double SinXi, CosXi;
+		FMath::SinCos(&SinXi, &CosXi, K * Xi);
+		XiPrime -= Beta[j] * SinXi * std::cosh(K * Eta);
+		EtaPrime -= Beta[j] * CosXi * std::sinh(K * Eta);
+	}
+
+	double SinXiPrime, CosXiPrime;
+	FMath::SinCos(&SinXiPrime, &CosXiPrime, XiPrime);
+	const double SinhEtaPrime = std::sinh(EtaPrime);
+
+	const double TauP = SinXiPrime / FMathd::Sqrt(SinhEtaPrime * SinhEtaPrime + CosXiPrime * CosXiPrime);
+	const double Lambda = FMathd::Atan2(SinhEtaPrime, CosXiPrime);
+
+	// Newton iterations to get the geodetic latitude tangent back from the conformal one, converges in 2 or 3 steps
+	double Tau = TauP;
+	for (int32 Iteration = 0; Iteration < 5; ++Iteration)
+	{
+		const double TauPI = TauPrime(Tau);
+		const double Delta = (TauP - TauPI) / FMathd::Sqrt(1.0 + TauPI * TauPI)
+			* (1.0 + (1.0 - EccentricitySquared) * Tau * Tau) / ((1.0 - EccentricitySquared) * FMathd::Sqrt(1.0 + Tau * Tau));
+		Tau += Delta;
+		if (FMathd::Abs(Delta) < 1e-14 * FMathd::Max(1.0, FMathd::Abs(Tau)))
+		{
+			break;
+		}
+	}
+
+	// Wrap the longitude in [-180, 180] like PROJ does, for zones next to the antimeridian
+	double Longitude = Parameters.CentralMeridian + FMathd::RadToDeg * Lambda;
+	if (Longitude > 180.0)
+	{
+		Longitude -= 360.0;
+	}
+	else if (Longitude < -180.0)
+	{
+		Longitude += 360.0;
+	}
+
+	return FGeographicCoordinates(Longitude, FMathd::RadToDeg * FMath::Atan(Tau), ProjectedCoordinates.Z);
+}
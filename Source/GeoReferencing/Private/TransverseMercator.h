@@ -0,0 +1,46 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GeographicCoordinates.h"
+
+/**
+ * Ellipsoidal Transverse Mercator projection (EPSG method 9807, used by UTM), evaluated with the 6th order Krüger series
+ * as given by Karney 2011, "Transverse Mercator with an accuracy of a few nanometers".
+ * Projected coordinates are (Easting, Northing, Up) in meters, geographic ones are in degrees. Altitude is passed through.
+ */
+class FTransverseMercator
+{
+public:
+	struct FParameters
+	{
+		double SemiMajorAxis = 6378137.0;
+		double Flattening = 1.0 / 298.257223563;
+		double LatitudeOfOrigin = 0.0; // degrees
+		double CentralMeridian = 0.0; // degrees
+		double ScaleFactor = 0.9996;
+		double FalseEasting = 500000.0;
+		double FalseNorthing = 0.0;
+	};
+
+	FTransverseMercator();
+	explicit FTransverseMercator(const FParameters& InParameters);
+
+	const FParameters& GetParameters() const { return Parameters; }
+
+	FVector GeographicToProjected(const FGeographicCoordinates& GeographicCoordinates) const;
+	FGeographicCoordinates ProjectedToGeographic(const FVector& ProjectedCoordinates) const;
+
+private:
+	// Conformal latitude tangent from the geodetic latitude tangent
+	double TauPrime(double Tau) const;
+
+	FParameters Parameters;
+	double Eccentricity;
+	double EccentricitySquared;
+	double ScaledRectifyingRadius; // k0 * A
+	double Xi0; // Rectifying latitude of the origin
+	double Alpha[6];
+	double Beta[6];
+};
@@ -27,4 +27,24 @@ public:
 
 	FVector GeodeticSurfaceNormal(const FVector& ECEFLocation) const;
 	FVector GeodeticSurfaceNormal(const FGeographicCoordinates& GeographicCoordinates) const;
+
+	/**
+	* True if the ellipsoid is an ellipsoid of revolution around Z (equal X and Y radii), as required by the closed-form conversions below
+	*/
+	bool IsOfRevolution() const;
+
+	/**
+	* Closed-form conversion from geodetic coordinates (degrees, meters) on this ellipsoid to ECEF (meters)
+	*/
+	FVector GeographicToECEF(const FGeographicCoordinates& GeographicCoordinates) const;
+
+	/**
+	* GeographicToECEF() also returning the East, North, Up unit vectors at this location, computed from the same sines and cosines
+	*/
+	FVector GeographicToECEFWithENU(const FGeographicCoordinates& GeographicCoordinates, FVector& East, FVector& North, FVector& Up) const;
+
+	/**
+	* Closed-form conversion from ECEF (meters) to geodetic coordinates (degrees, meters) on this ellipsoid - Vermeille (2011), no iteration
+	*/
+	FGeographicCoordinates ECEFToGeographic(const FVector& ECEFLocation) const;
 };
@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/** Called on the game thread once an asynchronous batch conversion is over, with false if it was cancelled or could not start */
+DECLARE_DELEGATE_OneParam(FOnGeoBatchCompleted, bool /* bSuccess */);
+
+/**
+ * Progress and cancellation of an asynchronous batch conversion (C++ only), shared between the caller and the conversion task.
+ * The task checks for cancellation between chunks, so Cancel() takes effect within a few milliseconds.
+ */
+class GEOREFERENCING_API FGeoBatchTaskHandle
+{
+public:
+	FGeoBatchTaskHandle() = default;
+
+	/** Ask the conversion to stop. The future then completes with a failure, and the coordinates are left partially converted. */
+	void Cancel() { bCancelRequested.store(true, std::memory_order_relaxed); }
+	bool IsCancelRequested() const { return bCancelRequested.load(std::memory_order_relaxed); }
+
+	int32 GetNumCoordinates() const { return NumCoordinates.load(std::memory_order_relaxed); }
+	int32 GetNumConverted() const { return NumConverted.load(std::memory_order_relaxed); }
+
+	/** Fraction of the coordinates converted so far, in [0, 1] */
+	float GetProgress() const
+	{
+		const int32 Total = GetNumCoordinates();
+		return Total > 0 ? static_cast<float>(GetNumConverted()) / static_cast<float>(Total) : 1.0f;
+	}
+
+	// Used by the conversion task
+	void Start(int32 InNumCoordinates)
+	{
+		NumCoordinates.store(InNumCoordinates, std::memory_order_relaxed);
+		NumConverted.store(0, std::memory_order_relaxed);
+	}
+	void AddConverted(int32 Num) { NumConverted.fetch_add(Num, std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> bCancelRequested { false };
+	std::atomic<int32> NumCoordinates { 0 };
+	std::atomic<int32> NumConverted { 0 };
+};
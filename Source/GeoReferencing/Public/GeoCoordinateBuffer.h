@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GeographicCoordinates.h"
+
+/**
+ * Structure of arrays container for batch coordinate conversions (C++ only).
+ * Coordinates are stored as three separate 64-byte aligned double arrays. For geographic coordinates, X = Longitude, Y = Latitude, Z = Altitude.
+ * The capacity is never released by SetNum() or Reset(), so a buffer reused from frame to frame does not allocate anymore once it reached its peak size.
+ */
+struct GEOREFERENCING_API FGeoCoordinateBuffer
+{
+	typedef TArray<double, TAlignedHeapAllocator<64>> FComponentArray;
+
+	FGeoCoordinateBuffer() = default;
+	explicit FGeoCoordinateBuffer(int32 InitialCapacity);
+
+	int32 Num() const { return X.Num(); }
+	bool IsEmpty() const { return X.Num() == 0; }
+
+	/** Resize the buffer. New elements are uninitialized, and the memory is kept when shrinking */
+	void SetNum(int32 NewNum);
+
+	/** Empty the buffer, keeping the memory */
+	void Reset();
+
+	/** Make sure the buffer can hold NewCapacity coordinates without reallocating */
+	void Reserve(int32 NewCapacity);
+
+	int32 Add(const FVector& Coordinates);
+	int32 Add(const FGeographicCoordinates& Coordinates);
+
+	FVector GetVector(int32 Index) const { return FVector(X[Index], Y[Index], Z[Index]); }
+	FGeographicCoordinates GetGeographic(int32 Index) const { return FGeographicCoordinates(X[Index], Y[Index], Z[Index]); }
+
+	void Set(int32 Index, const FVector& Coordinates);
+	void Set(int32 Index, const FGeographicCoordinates& Coordinates);
+
+	/** Fill the buffer from AoS arrays, and read it back */
+	void CopyFrom(TConstArrayView<FVector> Coordinates);
+	void CopyFrom(TConstArrayView<FGeographicCoordinates> Coordinates);
+	void CopyTo(TArrayView<FVector> Coordinates) const;
+	void CopyTo(TArrayView<FGeographicCoordinates> Coordinates) const;
+
+	FComponentArray X;
+	FComponentArray Y;
+	FComponentArray Z;
+};
+
+/**
+ * In place view on double precision coordinates owned by the caller (C++ only) : three pointers sharing a byte stride.
+ * Covers separate X/Y/Z arrays (Stride = sizeof(double)) as well as coordinate members of an array of structures,
+ * so that the location fields of instance or entity arrays can be converted without any intermediate copy.
+ * For geographic coordinates, X = Longitude, Y = Latitude, Z = Altitude.
+ */
+struct FGeoCoordinateStreams
+{
+	double* X = nullptr;
+	double* Y = nullptr;
+	double* Z = nullptr;
+	SIZE_T Stride = sizeof(double);
+	int32 Num = 0;
+
+	/** View on the X, Y, Z doubles found contiguously at ByteOffset in each element, e.g. Make(MakeArrayView(Instances), STRUCT_OFFSET(FMyInstance, Location)) */
+	template<typename ElementType>
+	static FGeoCoordinateStreams Make(TArrayView<ElementType> Elements, SIZE_T ByteOffset)
+	{
+		return Make(Elements, ByteOffset, ByteOffset + sizeof(double), ByteOffset + 2 * sizeof(double));
+	}
+
+	/** View on three double members of each element, given by their byte offsets */
+	template<typename ElementType>
+	static FGeoCoordinateStreams Make(TArrayView<ElementType> Elements, SIZE_T OffsetX, SIZE_T OffsetY, SIZE_T OffsetZ)
+	{
+		static_assert(!TIsConst<ElementType>::Value, "Coordinates are converted in place and can't be const");
+		check(FMath::Max3(OffsetX, OffsetY, OffsetZ) + sizeof(double) <= sizeof(ElementType));
+
+		uint8* Base = reinterpret_cast<uint8*>(Elements.GetData());
+		return { reinterpret_cast<double*>(Base + OffsetX), reinterpret_cast<double*>(Base + OffsetY), reinterpret_cast<double*>(Base + OffsetZ), sizeof(ElementType), Elements.Num() };
+	}
+
+	static FGeoCoordinateStreams Make(TArrayView<FVector> Vectors)
+	{
+		return Make(Vectors, STRUCT_OFFSET(FVector, X), STRUCT_OFFSET(FVector, Y), STRUCT_OFFSET(FVector, Z));
+	}
+
+	static FGeoCoordinateStreams Make(TArrayView<FGeographicCoordinates> Coordinates)
+	{
+		return Make(Coordinates, STRUCT_OFFSET(FGeographicCoordinates, Longitude), STRUCT_OFFSET(FGeographicCoordinates, Latitude), STRUCT_OFFSET(FGeographicCoordinates, Altitude));
+	}
+
+	static FGeoCoordinateStreams Make(TArrayView<double> InX, TArrayView<double> InY, TArrayView<double> InZ)
+	{
+		check(InY.Num() == InX.Num() && InZ.Num() == InX.Num());
+		return { InX.GetData(), InY.GetData(), InZ.GetData(), sizeof(double), InX.Num() };
+	}
+
+	static FGeoCoordinateStreams Make(FGeoCoordinateBuffer& Buffer)
+	{
+		return { Buffer.X.GetData(), Buffer.Y.GetData(), Buffer.Z.GetData(), sizeof(double), Buffer.Num() };
+	}
+
+	FORCEINLINE double& GetX(int32 Index) const { return *reinterpret_cast<double*>(reinterpret_cast<uint8*>(X) + Index * Stride); }
+	FORCEINLINE double& GetY(int32 Index) const { return *reinterpret_cast<double*>(reinterpret_cast<uint8*>(Y) + Index * Stride); }
+	FORCEINLINE double& GetZ(int32 Index) const { return *reinterpret_cast<double*>(reinterpret_cast<uint8*>(Z) + Index * Stride); }
+
+	FORCEINLINE FVector GetVector(int32 Index) const { return FVector(GetX(Index), GetY(Index), GetZ(Index)); }
+	FORCEINLINE void SetVector(int32 Index, const FVector& Value) const { GetX(Index) = Value.X; GetY(Index) = Value.Y; GetZ(Index) = Value.Z; }
+
+	/** Sub range [Start, Start + Count) */
+	FGeoCoordinateStreams Slice(int32 Start, int32 Count) const
+	{
+		return { &GetX(Start), &GetY(Start), &GetZ(Start), Stride, Count };
+	}
+};
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "GeoReferencingSystem.h"
+
+/**
+ * Settings of a FGeoLocalLinearization
+ */
+struct FGeoLocalLinearizationSettings
+{
+	/** Maximum predicted error of the linearized conversion, in meters */
+	double MaxErrorMeters = 0.001;
+
+	/** Distance to the anchor beyond which the conversion is re-anchored whatever the predicted error, in meters */
+	double MaxAnchorDistanceMeters = 1000.0;
+
+	/** Step of the finite differences sampling the Jacobian and the curvature at the anchor, in meters */
+	double StepMeters = 10.0;
+};
+
+/**
+ * Linearization of a conversion around an anchor point (C++ only), for objects converting their location every frame while moving a few meters.
+ *
+ * The exact conversion is sampled around the anchor to get its Jacobian and its curvature. Points within the radius where the predicted
+ * error stays below MaxErrorMeters are then converted with a single affine evaluation, others re-anchor the linearization on them (exact conversion).
+ * Distances and errors are measured in meters : geographic coordinates are scaled with a spherical approximation, engine ones from centimeters.
+ *
+ * One instance per tracked object, not thread safe. Anchoring calls the single point conversions of the GeoReferencing system, and must
+ * happen where those are allowed (game thread). The anchor is dropped by the first conversion following AGeoReferencingSystem::ApplySettings() or
+ * an origin rebase, see AGeoReferencingSystem::GetSettingsSerial().
+ */
+class GEOREFERENCING_API FGeoLocalLinearization
+{
+public:
+	FGeoLocalLinearization(AGeoReferencingSystem* InGeoReferencingSystem, EGeoConversion InConversion, const FGeoLocalLinearizationSettings& InSettings = FGeoLocalLinearizationSettings());
+
+	/**
+	 * Convert a point, in the FVector layout of the batch streams (Longitude, Latitude, Altitude for geographic coordinates).
+	 * Returns false if the GeoReferencing system is gone.
+	 */
+	bool Transform(const FVector& Input, FVector& Output);
+
+	/** Batch version, for points close to each other. Inputs and Outputs may be the same array. */
+	bool Transform(TConstArrayView<FVector> Inputs, TArrayView<FVector> Outputs);
+
+	/** Drop the anchor, the next point will be converted exactly */
+	void Reset() { bHasAnchor = false; }
+
+	EGeoConversion GetConversion() const { return Conversion; }
+	bool HasAnchor() const { return bHasAnchor; }
+	const FVector& GetAnchor() const { return AnchorInput; }
+
+	/** Distance to the anchor within which points are linearized, in meters */
+	double GetValidRadiusMeters() const { return ValidRadiusMeters; }
+
+	int64 GetNumTransforms() const { return NumTransforms; }
+	int64 GetNumAnchors() const { return NumAnchors; }
+
+	/** Fraction of the conversions which were exact, because they re-anchored the linearization */
+	double GetAnchorRate() const { return NumTransforms > 0 ? static_cast<double>(NumAnchors) / static_cast<double>(NumTransforms) : 0.0; }
+
+	void ResetCounters() { NumTransforms = 0; NumAnchors = 0; }
+
+private:
+	bool Anchor(const FVector& Input);
+	bool ConvertExact(AGeoReferencingSystem& GeoReferencingSystem, const FVector& Input, FVector& Output) const;
+
+	TWeakObjectPtr<AGeoReferencingSystem> GeoReferencingSystem;
+	EGeoConversion Conversion;
+	FGeoLocalLinearizationSettings Settings;
+
+	bool bHasAnchor = false;
+	uint32 AnchorSettingsSerial = 0; // Settings the anchor was sampled with
+	FVector AnchorInput = FVector::ZeroVector;
+	FVector AnchorOutput = FVector::ZeroVector;
+	FVector Jacobian[3]; // Columns : derivatives of the output along each input axis
+	FVector InputMetersPerUnit = FVector::OneVector;
+	double ValidRadiusMeters = 0.0;
+
+	int64 NumTransforms = 0;
+	int64 NumAnchors = 0;
+};
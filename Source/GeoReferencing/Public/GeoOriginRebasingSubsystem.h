@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GeoOriginRebasingSubsystem.generated.h"
+
+class AGeoReferencingSystem;
+
+/**
+ * Moves the georeferenced origin close to the view when the single precision spacing there exceeds the GeoReferencingSystem threshold
+ * (see AGeoReferencingSystem::bEnableOriginRebasing), then moves the movable actors so that they keep their geographic location.
+ * All the actors are moved in the frame of the origin change, their new transforms being computed in parallel. AGeoReferencingSystem::RebasingBudgetMilliseconds
+ * only decides whether a rebase can run in the current frame, see there.
+ * Actors attached to another one follow their parent, and actors set to ignore origin shifting are not moved. Static and stationary actors are not moved
+ * either : their baked lighting, navigation and static collision can't follow them at runtime. Content that must keep its geographic location across
+ * rebases has to be movable.
+ */
+UCLASS()
+class GEOREFERENCING_API UGeoOriginRebasingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	* Track this actor instead of the first local player's camera. nullptr restores the default.
+	**/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Origin Rebasing")
+	void SetTrackedActor(AActor* Actor);
+
+	/**
+	* Move the origin to EngineCoordinates now, whatever the precision there and the time it takes, and the actors with it.
+	**/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Origin Rebasing")
+	bool RebaseOriginAt(const FVector& EngineCoordinates);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// UWorldSubsystem
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	bool GetTrackedLocation(FVector& OutLocation) const;
+
+	// Root actors to move with the origin. Returns the number of static and stationary ones, which are left out.
+	int32 GatherActors(const AGeoReferencingSystem& GeoReferencingSystem, TArray<AActor*>& OutActors) const;
+
+	// Rebase the origin and move Actors in this frame
+	bool RebaseActors(AGeoReferencingSystem& GeoReferencingSystem, const FVector& EngineCoordinates, const TArray<AActor*>& Actors, int32 NumStaticActors);
+
+	// Measured time to move an actor, smoothed over the rebases, to estimate the time of the next one
+	double SecondsPerActor = 5.0e-6;
+
+	// The rebase exceeded the budget, it waits for the spacing to reach twice the threshold
+	bool bRebasePostponed = false;
+
+	TWeakObjectPtr<AActor> TrackedActor;
+};
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GeoReferencingSubsystem.generated.h"
+
+class AGeoReferencingSystem;
+
+/**
+ * Registry of the GeoReferencingSystem actors of a world. Actors register themselves when their components are registered
+ * and unregister when they leave the world, so finding the world's GeoReferencingSystem doesn't need to iterate over its actors.
+ */
+UCLASS()
+class GEOREFERENCING_API UGeoReferencingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Subsystem of the world of WorldContextObject, or nullptr */
+	static UGeoReferencingSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	* The GeoReferencingSystem of the world. Logs an error and returns nullptr if there is none, or more than one.
+	**/
+	UFUNCTION(BlueprintPure, Category = "GeoReferencing")
+	AGeoReferencingSystem* GetGeoReferencingSystem() const;
+
+	/**
+	* Same, without any error logged, for C++ hot paths. nullptr if there isn't exactly one GeoReferencingSystem in the world.
+	**/
+	FORCEINLINE AGeoReferencingSystem* GetCachedGeoReferencingSystem() const { return CachedGeoReferencingSystem; }
+
+	/** Number of GeoReferencingSystem actors in the world. There should be exactly one. */
+	UFUNCTION(BlueprintPure, Category = "GeoReferencing")
+	int32 GetNumGeoReferencingSystems() const { return GeoReferencingSystems.Num(); }
+
+	// Called by AGeoReferencingSystem
+	void RegisterGeoReferencingSystem(AGeoReferencingSystem* GeoReferencingSystem);
+	void UnregisterGeoReferencingSystem(AGeoReferencingSystem* GeoReferencingSystem);
+
+	// USubsystem
+	virtual void Deinitialize() override;
+
+protected:
+	// UWorldSubsystem
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void UpdateCachedGeoReferencingSystem();
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AGeoReferencingSystem>> GeoReferencingSystems;
+
+	// The only registered actor, nullptr if there are none or several
+	UPROPERTY(Transient)
+	TObjectPtr<AGeoReferencingSystem> CachedGeoReferencingSystem;
+};
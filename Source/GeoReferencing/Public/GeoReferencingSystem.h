@@ -6,13 +6,21 @@
 #include "GameFramework/Info.h"
 #include "Logging/LogMacros.h"
 #include "Templates/PimplPtr.h"
+#include "Misc/EnumRange.h"
+#include "Async/Future.h"
+#include "Engine/LatentActionManager.h"
 
 // Double precision structures
 #include "GeographicCoordinates.h"
 #include "Ellipsoid.h"
 #include "TransformationAccuracy.h"
+#include "GeoCoordinateBuffer.h"
+#include "GeoBatchTask.h"
+#include "GeoStreamingTransform.h"
 #include "GeoReferencingSystem.generated.h"
 
+struct FProjPipelines;
+class FGeoTransformerSnapshot;
 
 
 UENUM(BlueprintType)
@@ -31,6 +39,28 @@ enum class EPlanetShape : uint8 {
 	 RoundPlanet UMETA(DisplayName = "Round Planet"),
 };
 
+/**
+ * Directional conversion between the four coordinate systems handled by AGeoReferencingSystem : Engine, Projected, Geographic and ECEF
+ */
+UENUM(BlueprintType)
+enum class EGeoConversion : uint8 {
+	EngineToProjected,
+	ProjectedToEngine,
+	EngineToGeographic,
+	GeographicToEngine,
+	EngineToECEF,
+	ECEFToEngine,
+	ProjectedToGeographic,
+	GeographicToProjected,
+	ProjectedToECEF,
+	ECEFToProjected,
+	GeographicToECEF,
+	ECEFToGeographic,
+
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EGeoConversion, EGeoConversion::Count);
+
 /**
  * Structure containing error information from a georeferencing operation
  */
@@ -58,6 +88,41 @@ struct GEOREFERENCING_API FGeoReferencingError
 	}
 };
 
+/**
+ * Latency statistics of the batch conversions of one kind. Latencies are measured per call.
+ */
+USTRUCT(BlueprintType)
+struct GEOREFERENCING_API FGeoConversionStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	EGeoConversion Conversion = EGeoConversion::EngineToProjected;
+
+	/** Number of batch calls */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	int64 NumCalls = 0;
+
+	/** Number of coordinates converted by these calls */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	int64 TotalTransformations = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP50Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP90Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP99Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP999Microseconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double MaxLatencyMicroseconds = 0.0;
+};
+
 /**
  * Structure containing performance statistics for georeferencing operations
  */
@@ -78,24 +143,195 @@ struct GEOREFERENCING_API FGeoReferencingStats
 	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
 	double MaxTransformTimeMicroseconds = 0.0;
 
-	/** Number of cache hits (if caching is implemented) */
+	/** Median latency of the batch calls, in microseconds. Percentiles are read from log-linear histograms, within 6%. */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP50Microseconds = 0.0;
+
+	/** 90th percentile of the batch calls latency, in microseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP90Microseconds = 0.0;
+
+	/** 99th percentile of the batch calls latency, in microseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP99Microseconds = 0.0;
+
+	/** 99.9th percentile of the batch calls latency, in microseconds */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double LatencyP999Microseconds = 0.0;
+
+	/** Latency statistics for each kind of conversion used since last reset. TransformCoordinates calls only count in the totals. */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	TArray<FGeoConversionStats> Conversions;
+
+	/** Latency statistics of the tangent frame batches (GetTangentTransformsAt*Locations, GetTangentMatricesAt*Locations), kept out of the conversions and the totals. Conversion is not used. */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	FGeoConversionStats TangentFrames;
+
+	/** Number of coordinate cache hits (see bUseCoordinateCache) */
 	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
 	int32 CacheHits = 0;
 
-	/** Number of cache misses (if caching is implemented) */
+	/** Number of coordinate cache misses (see bUseCoordinateCache) */
 	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
 	int32 CacheMisses = 0;
 
+	/** Largest error measured on the test points of the last approximate batch, in meters (see bUseApproximateBatches) */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double ApproximationMaxErrorMeters = 0.0;
+
+	/** Speedup of the last approximate batch over exact conversions, estimated from the timing of the exact samples */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double ApproximationSpeedup = 0.0;
+
 	FGeoReferencingStats()
 		: TotalTransformations(0)
 		, AverageTransformTimeMicroseconds(0.0)
 		, MaxTransformTimeMicroseconds(0.0)
+		, LatencyP50Microseconds(0.0)
+		, LatencyP90Microseconds(0.0)
+		, LatencyP99Microseconds(0.0)
+		, LatencyP999Microseconds(0.0)
 		, CacheHits(0)
 		, CacheMisses(0)
+		, ApproximationMaxErrorMeters(0.0)
+		, ApproximationSpeedup(0.0)
 	{
 	}
 };
 
+/**
+ * Distortion of the projected CRS at a specific location, see AGeoReferencingSystem::GetProjectionFactors()
+ */
+USTRUCT(BlueprintType)
+struct GEOREFERENCING_API FGeoProjectionFactors
+{
+	GENERATED_BODY()
+
+	/** Angle from the grid north to the true north, in degrees, positive when the true north is east of the grid north */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double MeridianConvergence = 0.0;
+
+	/** Scale factor along the meridian */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double MeridionalScale = 1.0;
+
+	/** Scale factor along the parallel */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double ParallelScale = 1.0;
+
+	/** Areal scale factor */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double ArealScale = 1.0;
+
+	/** Maximum angular distortion, in degrees. 0 for conformal projections. */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double AngularDistortion = 0.0;
+
+	/** Angle between the projected meridian and parallel, in degrees. 90 for conformal projections. */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double MeridianParallelAngle = 90.0;
+
+	/** Partial derivatives of the projected coordinates, in projected units per radian of longitude (Lambda) or latitude (Phi) */
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double DxDLambda = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double DxDPhi = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double DyDLambda = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
+	double DyDPhi = 0.0;
+};
+
+/**
+ * State resolved by ApplySettings() against the PROJ database, saved with the actor when it is cooked.
+ * At runtime the pipelines are rebuilt from their PROJ strings, which needs neither the CRS database nor the origin computations.
+ */
+USTRUCT()
+struct GEOREFERENCING_API FGeoReferencingCookedState
+{
+	GENERATED_BODY()
+
+	/** Hash of the settings the state was resolved for. The state is ignored if they changed since. 0 when no state was cooked. */
+	UPROPERTY()
+	uint32 SettingsHash = 0;
+
+	/** PROJ strings of the pipelines, as normalized for visualization */
+	UPROPERTY()
+	FString ProjectedToGeographicDefinition;
+
+	UPROPERTY()
+	FString ProjectedToECEFDefinition;
+
+	UPROPERTY()
+	FString GeographicToECEFDefinition;
+
+	/** PROJ string of the map projection of the Projected CRS, for the projection factors. Empty if it is not a projection. */
+	UPROPERTY()
+	FString ProjectionDefinition;
+
+	UPROPERTY()
+	FVector ProjectedEllipsoidRadii = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector GeographicEllipsoidRadii = FVector::ZeroVector;
+
+	/** Origin frame (RoundPlanet) and offset (FlatPlanet) */
+	UPROPERTY()
+	FMatrix WorldFrameToECEFFrame = FMatrix::Identity;
+
+	UPROPERTY()
+	FVector WorldOriginLocationProjected = FVector::ZeroVector;
+
+	/** Outcome of the native conversions validation */
+	UPROPERTY()
+	bool bNativeGeographicToECEF = false;
+
+	UPROPERTY()
+	bool bNativeTransverseMercator = false;
+
+	/** Transverse Mercator parameters, when bNativeTransverseMercator is set */
+	UPROPERTY()
+	double TransverseMercatorSemiMajorAxis = 0.0;
+
+	UPROPERTY()
+	double TransverseMercatorFlattening = 0.0;
+
+	UPROPERTY()
+	double TransverseMercatorLatitudeOfOrigin = 0.0;
+
+	UPROPERTY()
+	double TransverseMercatorCentralMeridian = 0.0;
+
+	UPROPERTY()
+	double TransverseMercatorScaleFactor = 0.0;
+
+	UPROPERTY()
+	double TransverseMercatorFalseEasting = 0.0;
+
+	UPROPERTY()
+	double TransverseMercatorFalseNorthing = 0.0;
+};
+
+/**
+ * Location expressed in one cell of the local frames grid, see AGeoReferencingSystem::bUseLocalFrameGrid
+ */
+USTRUCT(BlueprintType)
+struct GEOREFERENCING_API FGeoLocalFrameCoordinates
+{
+	GENERATED_BODY()
+
+	/** Cell of the grid, INDEX_NONE if the location is outside of it */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing")
+	int32 CellId = INDEX_NONE;
+
+	/** Coordinates in the tangent frame at the cell center, in engine units and axes (X East, -Y North, Z Up) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing")
+	FVector LocalCoordinates = FVector::ZeroVector;
+};
+
 /**
  * Structure containing coordinate precision information at a specific location
  */
@@ -104,7 +340,7 @@ struct GEOREFERENCING_API FCoordinatePrecision
 {
 	GENERATED_BODY()
 
-	/** Estimated precision at this location in centimeters */
+	/** Spacing between two consecutive single precision floats at this location, in centimeters (largest of the 3 components) */
 	UPROPERTY(BlueprintReadOnly, Category = "GeoReferencing")
 	double PrecisionCentimeters = 0.0;
 
@@ -128,6 +364,9 @@ struct GEOREFERENCING_API FCoordinatePrecision
 	}
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGeoReferencingReadySignature, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGeoReferencingOriginRebasedSignature, const FTransform&, OldToNewEngine);
+
 /**
  * This AInfos enable you to define a correspondance between the UE origin and an actual geographic location on a planet
  * Once done it offers different functions to convert coordinates between UE and Geographic coordinates
@@ -143,10 +382,27 @@ public:
 	virtual void PostLoad() override;
 	virtual void PostActorCreated() override;
 	virtual void BeginDestroy() override;
+	virtual void PostRegisterAllComponents() override;
+	virtual void PostUnregisterAllComponents() override;
 
+	/**
+	* The GeoReferencingSystem of the world, found in constant time through UGeoReferencingSubsystem. Logs an error if there is none, or more than one.
+	**/
 	UFUNCTION(BlueprintPure, Category = "GeoReferencing", meta = (WorldContext = "WorldContextObject"))
 	static AGeoReferencingSystem* GetGeoReferencingSystem(UObject* WorldContextObject);
 
+	/**
+	* True once PROJ is initialized and the settings applied. Until then, functions needing them wait for the initialization to complete.
+	*/
+	UFUNCTION(BlueprintPure, Category = "GeoReferencing")
+	bool IsReady() const;
+
+	/**
+	* Broadcast on the game thread when the initialization is complete, with false if a CRS definition could not be used. Check IsReady() before binding, it is only broadcast once.
+	*/
+	UPROPERTY(BlueprintAssignable, Category = "GeoReferencing")
+	FGeoReferencingReadySignature OnReady;
+
 #pragma region New Prototypes for Blueprints
 	// We want to keep the same function names, but with a change in some argument types. UBT doesn't support that unless
 	// we create the new functions with a K2_ prefix and use the meta/Displayname tag to keep the same name. 
@@ -326,12 +582,39 @@ public:
 	* @param SourceCRS The source CRS (e.g., "EPSG:4326")
 	* @param TargetCRS The target CRS (e.g., "EPSG:4978")
 	* @return Accuracy information about the transformation
+	* The transformation pipeline and its accuracy are kept in a registry of size TransformationRegistryCapacity, so only the first query of a CRS pair hits the PROJ database.
 	*/
 	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Accuracy")
 	FTransformationAccuracy GetTransformationAccuracy(
 		const FString& SourceCRS,
 		const FString& TargetCRS);
 
+	/**
+	* Convert coordinates between two arbitrary CRS, independently of the ones set on this system
+	* Geographic CRS use the Longitude, Latitude order (X = Longitude, Y = Latitude), whatever the CRS definition says.
+	* The pipeline is built on first use and kept in a registry of size TransformationRegistryCapacity.
+	* @param SourceCRS The source CRS (e.g., "EPSG:4326")
+	* @param TargetCRS The target CRS (e.g., "EPSG:32631")
+	* @param SourceCoordinates Coordinates to convert, expressed in SourceCRS
+	* @param TargetCoordinates Output array of coordinates expressed in TargetCRS
+	* @return False if no transformation could be created between the two CRS
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Transformations|Batch")
+	bool TransformCoordinates(
+		const FString& SourceCRS,
+		const FString& TargetCRS,
+		const TArray<FVector>& SourceCoordinates,
+		TArray<FVector>& TargetCoordinates);
+
+	/**
+	* C++ only: Convert coordinates between two arbitrary CRS, in place in caller owned memory (see FGeoCoordinateStreams)
+	* @return False if no transformation could be created between the two CRS
+	*/
+	bool TransformCoordinates(
+		const FString& SourceCRS,
+		const FString& TargetCRS,
+		const FGeoCoordinateStreams& Coordinates);
+
 	/**
 	* C++ version: Try to convert geographic coordinates to engine coordinates with optional error message
 	* @param Geographic The geographic coordinates to convert
@@ -368,15 +651,197 @@ public:
 
 	/**
 	* C++ only: Convert multiple geographic coordinates to engine coordinates using parallel processing
+	* Each worker leases its own PROJ context and pipelines, so the chunks never share PROJ objects.
 	* @param Geographic Array of geographic coordinates to convert
 	* @param Engine Output array of engine coordinates
-	* @param NumThreads Number of threads to use (default: 4)
+	* @param NumThreads Number of threads to use (default: 4), clamped to the number of task graph worker threads plus the calling one
 	*/
 	void GeographicToEngineBatchParallel(
 		const TArray<FGeographicCoordinates>& Geographic,
 		TArray<FVector>& Engine,
 		int32 NumThreads = 4);
 
+	// Asynchronous Batch Transformations
+
+	/**
+	* C++ only: Convert a structure of arrays buffer in place, on a background thread.
+	* Must be called from the game thread : the batch is registered with the internals that Initialize() replaces and that the destruction releases, and both only
+	* wait for the batches registered before them. Background threads can convert through GetTransformerSnapshot() instead.
+	* The conversion runs through the transformer snapshot of submission time, see GetTransformerSnapshot(). Running conversions are cancelled by ApplySettings()
+	* and when the system is destroyed, while RebaseOrigin() lets them complete in the engine frame they were started with.
+	* @param Conversion Source and destination coordinate systems
+	* @param Coordinates Buffer to convert, kept alive by the task
+	* @param Task Optional handle to follow the progress and to cancel the conversion
+	* @return Future set to true once all the coordinates are converted, or to false if the conversion was cancelled or could not start
+	*/
+	TFuture<bool> TransformBatchAsync(EGeoConversion Conversion, TSharedRef<FGeoCoordinateBuffer> Coordinates, TSharedPtr<FGeoBatchTaskHandle> Task = nullptr);
+
+	/**
+	* C++ only: TransformBatchAsync() calling a delegate on the game thread once the conversion is over, instead of returning a future
+	* @param OnCompleted Called with true once all the coordinates are converted, or with false if the conversion was cancelled or could not start
+	* @return Handle to follow the progress and to cancel the conversion, Task if given
+	*/
+	TSharedRef<FGeoBatchTaskHandle> TransformBatchAsync(EGeoConversion Conversion, TSharedRef<FGeoCoordinateBuffer> Coordinates, FOnGeoBatchCompleted OnCompleted, TSharedPtr<FGeoBatchTaskHandle> Task = nullptr);
+
+	/**
+	* C++ only: Convert Engine, Projected or ECEF coordinates on a background thread, see TransformBatchAsync()
+	* @return Future holding the converted coordinates, or an empty array if the conversion was cancelled
+	*/
+	TFuture<TArray<FVector>> TransformBatchAsync(EGeoConversion Conversion, const TArray<FVector>& Coordinates, TSharedPtr<FGeoBatchTaskHandle> Task = nullptr);
+
+	/**
+	* C++ only: GeographicToEngineBatch() on a background thread, see TransformBatchAsync()
+	* @return Future holding the engine coordinates, or an empty array if the conversion was cancelled
+	*/
+	TFuture<TArray<FVector>> GeographicToEngineBatchAsync(const TArray<FGeographicCoordinates>& GeographicCoordinates, TSharedPtr<FGeoBatchTaskHandle> Task = nullptr);
+
+	/**
+	* C++ only: EngineToGeographicBatch() on a background thread, see TransformBatchAsync()
+	* @return Future holding the geographic coordinates, or an empty array if the conversion was cancelled
+	*/
+	TFuture<TArray<FGeographicCoordinates>> EngineToGeographicBatchAsync(const TArray<FVector>& EngineCoordinates, TSharedPtr<FGeoBatchTaskHandle> Task = nullptr);
+
+	/**
+	* Convert multiple geographic coordinates to engine coordinates on a background thread, without blocking the game
+	* @param GeographicCoordinates Array of geographic coordinates to convert
+	* @param EngineCoordinates Output array of engine coordinates, set when the conversion completes
+	* @param bSuccess False if the conversion was cancelled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Transformations|Batch", meta = (Latent, LatentInfo = "LatentInfo", DisplayName = "Geographic To Engine Batch (Async)"))
+	void GeographicToEngineBatchLatent(
+		const TArray<FGeographicCoordinates>& GeographicCoordinates,
+		TArray<FVector>& EngineCoordinates,
+		bool& bSuccess,
+		FLatentActionInfo LatentInfo);
+
+	/**
+	* Convert multiple engine coordinates to geographic coordinates on a background thread, without blocking the game
+	* @param EngineCoordinates Array of engine coordinates to convert
+	* @param GeographicCoordinates Output array of geographic coordinates, set when the conversion completes
+	* @param bSuccess False if the conversion was cancelled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Transformations|Batch", meta = (Latent, LatentInfo = "LatentInfo", DisplayName = "Engine To Geographic Batch (Async)"))
+	void EngineToGeographicBatchLatent(
+		const TArray<FVector>& EngineCoordinates,
+		TArray<FGeographicCoordinates>& GeographicCoordinates,
+		bool& bSuccess,
+		FLatentActionInfo LatentInfo);
+
+	/**
+	* Convert Engine, Projected or ECEF coordinates on a background thread, without blocking the game
+	* @param Conversion Source and destination coordinate systems. Geographic coordinates are stored as X = Longitude, Y = Latitude, Z = Altitude
+	* @param Coordinates Array of coordinates to convert
+	* @param OutCoordinates Output array of converted coordinates, set when the conversion completes
+	* @param bSuccess False if the conversion was cancelled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Transformations|Batch", meta = (Latent, LatentInfo = "LatentInfo", DisplayName = "Transform Batch (Async)"))
+	void TransformBatchLatent(
+		EGeoConversion Conversion,
+		const TArray<FVector>& Coordinates,
+		TArray<FVector>& OutCoordinates,
+		bool& bSuccess,
+		FLatentActionInfo LatentInfo);
+
+	/**
+	* Cancel all the running asynchronous batch conversions
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Transformations|Batch")
+	void CancelAsyncBatches();
+
+	/**
+	* Get the progress of the running asynchronous batch conversions
+	* @return Fraction of the coordinates converted so far, in [0, 1]. 1 if no conversion is running
+	*/
+	UFUNCTION(BlueprintPure, Category = "GeoReferencing|Transformations|Batch")
+	float GetAsyncBatchesProgress() const;
+
+	// Streaming Transformations
+
+	/**
+	* C++ only: Convert coordinates too many to fit in memory, from an archive to another. Can be called from any thread, e.g. a background task.
+	* The points are converted with the settings in use when the conversion starts (see GetTransformerSnapshot()), whatever ApplySettings() or origin rebasing do meanwhile.
+	* Both archives hold raw X, Y, Z doubles in native byte order, 24 bytes per point (Geographic as Longitude, Latitude, Altitude).
+	* Chunks are read, converted on worker threads and written in a pipeline : the conversion of a chunk overlaps the writing of the previous one and the reading of the next one.
+	* @param Conversion Source and destination coordinate systems
+	* @param Reader Archive positioned on the first point. Must know its size.
+	* @param Writer Archive receiving the converted points
+	* @param Settings Chunk size, number of workers and progress callback
+	* @param OutStats Number of points converted and throughput
+	* @return false if the input is not made of whole points, if an archive fails, or if the progress callback stopped the conversion
+	*/
+	bool TransformArchive(EGeoConversion Conversion, FArchive& Reader, FArchive& Writer, const FGeoStreamingTransformSettings& Settings, FGeoStreamingTransformStats& OutStats);
+
+	/**
+	* C++ only: TransformArchive() from a file to another
+	*/
+	bool TransformFile(EGeoConversion Conversion, const FString& InputFilename, const FString& OutputFilename, const FGeoStreamingTransformSettings& Settings, FGeoStreamingTransformStats& OutStats);
+
+	/**
+	* C++ only: Convert engine coordinates to ECEF, stored as separate X, Y and Z arrays (structure of arrays)
+	* In RoundPlanet mode, the UE units conversion and the frame matrix are fused in a single SIMD pass processing several points per instruction.
+	* All arrays must have the same size. Output arrays may be the input ones to convert in place.
+	*/
+	void EngineToECEFBatch(
+		TConstArrayView<double> EngineX, TConstArrayView<double> EngineY, TConstArrayView<double> EngineZ,
+		TArrayView<double> ECEFX, TArrayView<double> ECEFY, TArrayView<double> ECEFZ);
+
+	/**
+	* C++ only: Convert ECEF coordinates to engine coordinates, stored as separate X, Y and Z arrays (structure of arrays)
+	* In RoundPlanet mode, the frame matrix and the UE units conversion are fused in a single SIMD pass processing several points per instruction.
+	* All arrays must have the same size. Output arrays may be the input ones to convert in place.
+	*/
+	void ECEFToEngineBatch(
+		TConstArrayView<double> ECEFX, TConstArrayView<double> ECEFY, TConstArrayView<double> ECEFZ,
+		TArrayView<double> EngineX, TArrayView<double> EngineY, TArrayView<double> EngineZ);
+
+	/**
+	* C++ only: Convert all the coordinates of a structure of arrays buffer in place
+	* Each conversion stage runs on chunks of the buffer, as a single proj_trans_generic call or a SIMD pass. Nothing is allocated.
+	* For geographic coordinates, the buffer holds X = Longitude, Y = Latitude, Z = Altitude.
+	* @param Conversion Source and destination coordinate systems
+	* @param Coordinates Buffer holding the source coordinates, which are replaced by the converted ones
+	*/
+	void TransformBatch(EGeoConversion Conversion, FGeoCoordinateBuffer& Coordinates);
+
+	/**
+	* C++ only: Convert coordinates stored as separate X, Y and Z arrays (structure of arrays)
+	* All arrays must have the same size. Output arrays may be the input ones to convert in place.
+	*/
+	void TransformBatch(
+		EGeoConversion Conversion,
+		TConstArrayView<double> InX, TConstArrayView<double> InY, TConstArrayView<double> InZ,
+		TArrayView<double> OutX, TArrayView<double> OutY, TArrayView<double> OutZ);
+
+	/**
+	* C++ only: Convert coordinates in place, in memory owned by the caller, e.g. the location members of an array of structures
+	* Nothing is allocated or copied. See FGeoCoordinateStreams::Make() to build the view.
+	* @param Conversion Source and destination coordinate systems
+	* @param Coordinates View on the source coordinates, which are replaced by the converted ones
+	*/
+	void TransformBatch(EGeoConversion Conversion, const FGeoCoordinateStreams& Coordinates);
+
+	/** C++ only: In place conversions of caller owned coordinates, see TransformBatch() */
+	void GeographicToEngineBatch(const FGeoCoordinateStreams& Coordinates) { TransformBatch(EGeoConversion::GeographicToEngine, Coordinates); }
+	void EngineToGeographicBatch(const FGeoCoordinateStreams& Coordinates) { TransformBatch(EGeoConversion::EngineToGeographic, Coordinates); }
+	void EngineToECEFBatch(const FGeoCoordinateStreams& Coordinates) { TransformBatch(EGeoConversion::EngineToECEF, Coordinates); }
+	void ECEFToEngineBatch(const FGeoCoordinateStreams& Coordinates) { TransformBatch(EGeoConversion::ECEFToEngine, Coordinates); }
+	void GeographicToECEFBatch(const FGeoCoordinateStreams& Coordinates) { TransformBatch(EGeoConversion::GeographicToECEF, Coordinates); }
+	void ECEFToGeographicBatch(const FGeoCoordinateStreams& Coordinates) { TransformBatch(EGeoConversion::ECEFToGeographic, Coordinates); }
+
+	/** C++ only: In place conversions of a structure of arrays buffer, see TransformBatch() */
+	void EngineToProjectedBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::EngineToProjected, Coordinates); }
+	void ProjectedToEngineBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::ProjectedToEngine, Coordinates); }
+	void EngineToGeographicBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::EngineToGeographic, Coordinates); }
+	void GeographicToEngineBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::GeographicToEngine, Coordinates); }
+	void EngineToECEFBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::EngineToECEF, Coordinates); }
+	void ECEFToEngineBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::ECEFToEngine, Coordinates); }
+	void ProjectedToGeographicBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::ProjectedToGeographic, Coordinates); }
+	void GeographicToProjectedBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::GeographicToProjected, Coordinates); }
+	void ProjectedToECEFBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::ProjectedToECEF, Coordinates); }
+	void ECEFToProjectedBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::ECEFToProjected, Coordinates); }
+	void GeographicToECEFBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::GeographicToECEF, Coordinates); }
+	void ECEFToGeographicBatch(FGeoCoordinateBuffer& Coordinates) { TransformBatch(EGeoConversion::ECEFToGeographic, Coordinates); }
+
 	// Performance Monitoring
 
 	/**
@@ -505,6 +970,55 @@ public:
 	*/
 	FTransform GetTangentTransformAtECEFLocation(const FVector& ECEFCoordinates);
 
+	/**
+	* Get the transforms to locate objects tangent to Ellipsoid at many locations, e.g. to place instances. Computed in parallel.
+	* @param GeographicCoordinates Locations of the objects
+	* @param Transforms Output array of transforms, same as GetTangentTransformAtGeographicLocation() for each location
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|TangentTransforms")
+	void GetTangentTransformsAtGeographicLocations(const TArray<FGeographicCoordinates>& GeographicCoordinates, TArray<FTransform>& Transforms);
+
+	/**
+	* Get the transforms to locate objects tangent to Ellipsoid at many locations, e.g. to place instances. Computed in parallel.
+	* @param EngineCoordinates Locations of the objects
+	* @param Transforms Output array of transforms, same as GetTangentTransformAtEngineLocation() for each location
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|TangentTransforms")
+	void GetTangentTransformsAtEngineLocations(const TArray<FVector>& EngineCoordinates, TArray<FTransform>& Transforms);
+
+	/**
+	* C++ only: Batch versions of GetTangentTransformAt*Location(), writing to caller-owned arrays of the same size as the input
+	*/
+	void GetTangentTransformsAtGeographicLocations(TConstArrayView<FGeographicCoordinates> GeographicCoordinates, TArrayView<FTransform> Transforms);
+	void GetTangentTransformsAtEngineLocations(TConstArrayView<FVector> EngineCoordinates, TArrayView<FTransform> Transforms);
+	void GetTangentTransformsAtProjectedLocations(TConstArrayView<FVector> ProjectedCoordinates, TArrayView<FTransform> Transforms);
+	void GetTangentTransformsAtECEFLocations(TConstArrayView<FVector> ECEFCoordinates, TArrayView<FTransform> Transforms);
+
+	/**
+	* C++ only: Same as GetTangentTransformsAt*Locations(), as matrices ready for instanced static mesh components (no FTransform decomposition)
+	*/
+	void GetTangentMatricesAtGeographicLocations(TConstArrayView<FGeographicCoordinates> GeographicCoordinates, TArrayView<FMatrix> Matrices);
+	void GetTangentMatricesAtEngineLocations(TConstArrayView<FVector> EngineCoordinates, TArrayView<FMatrix> Matrices);
+	void GetTangentMatricesAtProjectedLocations(TConstArrayView<FVector> ProjectedCoordinates, TArrayView<FMatrix> Matrices);
+	void GetTangentMatricesAtECEFLocations(TConstArrayView<FVector> ECEFCoordinates, TArrayView<FMatrix> Matrices);
+
+	// Projection factors
+
+	/**
+	* Get the meridian convergence and scale factors of the projected CRS at a location, computed analytically by PROJ.
+	* With bUseProjectionFactorsCache, locations in the same cell share the factors computed at the cell center.
+	* Returns false if the projected CRS is not a projection PROJ can differentiate, or the location is outside its domain.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Projection")
+	bool GetProjectionFactors(const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors);
+
+	/**
+	* Batch version of GetProjectionFactors(), exact at every location (the cache is not used).
+	* Returns false if the factors could not be computed at some locations, which are then left to their default (undistorted) values.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Projection")
+	bool GetProjectionFactorsBatch(const TArray<FGeographicCoordinates>& GeographicCoordinates, TArray<FGeoProjectionFactors>& Factors);
+
 	/**
 	* Set this transform to an Ellipsoid to have it positioned tangent to the origin.
 	*/
@@ -639,15 +1153,296 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Origin Location", meta = (EditConditionHides, EditCondition = "bOriginLocationInProjectedCRS && !bOriginAtPlanetCenter"))
 	double OriginProjectedCoordinatesUp = 0.0;
 
+	// Origin Rebasing
+
+	/**
+	* If true, the origin is moved to the first local player's view (or the actor given to UGeoOriginRebasingSubsystem::SetTrackedActor) when
+	* the single precision spacing there exceeds RebasingPrecisionThresholdCentimeters, and the movable actors are moved accordingly. Game worlds only.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Origin Rebasing", meta = (EditCondition = "!bOriginAtPlanetCenter"))
+	bool bEnableOriginRebasing = false;
+
+	/**
+	* Single precision spacing (in cm) above which the origin is rebased. 0.1 cm is reached about 10 km away from the origin.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Origin Rebasing", meta = (ClampMin = "0.0001"))
+	double RebasingPrecisionThresholdCentimeters = 0.1;
+
+	/**
+	* Frame time a rebase may take. All the actors are moved in the frame of the rebase : when the estimated time exceeds the budget, the rebase is
+	* postponed until the single precision spacing reaches twice RebasingPrecisionThresholdCentimeters, and done then whatever its time.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Origin Rebasing", meta = (ClampMin = "0.1"))
+	double RebasingBudgetMilliseconds = 2.0;
+
+	/**
+	* Move the origin to EngineCoordinates. Only the origin transforms are updated : the CRS pipelines and local frames are kept, and the asynchronous
+	* batches keep running in the engine frame they were started with. Actors are left where they are, see UGeoOriginRebasingSubsystem to move them.
+	* @param OldToNewEngine Rigid transform from the previous engine coordinates to the new ones, a rotation is included for RoundPlanet
+	* @return False if the origin is at the planet center, or if the new settings could not be applied (the previous origin is then restored)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Precision")
+	bool RebaseOrigin(const FVector& EngineCoordinates, FTransform& OldToNewEngine);
+
+	/**
+	* Broadcast by RebaseOrigin() once the new origin is applied. Engine coordinates kept by the listeners must be transformed by OldToNewEngine.
+	*/
+	UPROPERTY(BlueprintAssignable, Category = "GeoReferencing")
+	FGeoReferencingOriginRebasedSignature OnOriginRebased;
+
+	/** Spacing between two consecutive single precision floats of magnitude ValueCentimeters */
+	static double GetSinglePrecisionSpacing(double ValueCentimeters);
+
+	// Local Frames Grid
+
+	/**
+	* If true, ApplySettings() builds a grid of tangent frames (East, North, Up at each cell center, on the Geographic CRS ellipsoid), so that
+	* far away content can be expressed in the frame of its own cell, with local coordinates as precise as near the origin. 128 bytes per cell.
+	* The grid is only rebuilt when its settings or the Geographic CRS change.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Local Frames")
+	bool bUseLocalFrameGrid = false;
+
+	/**
+	* Size of the cells, in degrees of longitude and latitude
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Local Frames", meta = (EditCondition = "bUseLocalFrameGrid", ClampMin = "0.01", ClampMax = "90"))
+	double LocalFrameGridCellSizeDegrees = 1.0;
+
+	/**
+	* Area covered by the grid, in degrees. Locations outside of it have no cell. A minimum longitude above the maximum one is a range crossing the antimeridian.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Local Frames", meta = (EditCondition = "bUseLocalFrameGrid", ClampMin = "-180", ClampMax = "180"))
+	double LocalFrameGridMinLongitude = -180.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Local Frames", meta = (EditCondition = "bUseLocalFrameGrid", ClampMin = "-180", ClampMax = "180"))
+	double LocalFrameGridMaxLongitude = 180.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Local Frames", meta = (EditCondition = "bUseLocalFrameGrid", ClampMin = "-90", ClampMax = "90"))
+	double LocalFrameGridMinLatitude = -90.0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GeoReferencing|Local Frames", meta = (EditCondition = "bUseLocalFrameGrid", ClampMin = "-90", ClampMax = "90"))
+	double LocalFrameGridMaxLatitude = 90.0;
+
+	/**
+	* Cell of the grid containing a location, in constant time. INDEX_NONE if the grid is disabled or the location is outside of it.
+	*/
+	UFUNCTION(BlueprintPure, Category = "GeoReferencing|Local Frames")
+	int32 GetLocalFrameCellId(const FGeographicCoordinates& GeographicCoordinates) const;
+
+	/**
+	* Center of a cell, at altitude 0. False if CellId is not a cell of the grid.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool GetLocalFrameCellOrigin(int32 CellId, FGeographicCoordinates& GeographicCoordinates) const;
+
+	/**
+	* Convert a location to the frame of the cell containing it. False if it is outside of the grid.
+	* Cells are picked from the longitude and latitude. For ECEF and engine inputs, they are computed with the closed-form conversion on the
+	* Geographic CRS ellipsoid, so a location close to a border may be given the neighbour cell. Local coordinates are exact in the returned cell.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool GeographicToLocalFrame(const FGeographicCoordinates& GeographicCoordinates, FGeoLocalFrameCoordinates& LocalFrameCoordinates);
+
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool ECEFToLocalFrame(const FVector& ECEFCoordinates, FGeoLocalFrameCoordinates& LocalFrameCoordinates);
+
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool EngineToLocalFrame(const FVector& EngineCoordinates, FGeoLocalFrameCoordinates& LocalFrameCoordinates);
+
+	/**
+	* Convert a location expressed in the frame of a cell. The local coordinates may be outside of the cell. False if CellId is not a cell of the grid.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool LocalFrameToECEF(const FGeoLocalFrameCoordinates& LocalFrameCoordinates, FVector& ECEFCoordinates);
+
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool LocalFrameToGeographic(const FGeoLocalFrameCoordinates& LocalFrameCoordinates, FGeographicCoordinates& GeographicCoordinates);
+
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool LocalFrameToEngine(const FGeoLocalFrameCoordinates& LocalFrameCoordinates, FVector& EngineCoordinates);
+
+	/**
+	* Rigid transform from the frame of a cell to the frame of another one, e.g. to place content of a neighbour cell in the current one
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool GetLocalFrameToLocalFrameTransform(int32 SourceCellId, int32 TargetCellId, FTransform& Transform);
+
+	/**
+	* Rigid transform from the frame of a cell to the engine frame, e.g. to place a streaming level authored in its cell frame. RoundPlanet only.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "GeoReferencing|Local Frames")
+	bool GetLocalFrameToEngineTransform(int32 CellId, FTransform& Transform);
+
+	// Thread safe access
+
+	/**
+	* C++ only: The conversions state published by the last ApplySettings(). Waits for the initialization like the other functions, null if it failed or the actor is being destroyed.
+	* Costs a short read lock and a reference count increment.
+	* The snapshot can be used from any thread and stays valid after later settings changes, see FGeoTransformerSnapshot.
+	*/
+	TSharedPtr<const FGeoTransformerSnapshot, ESPMode::ThreadSafe> GetTransformerSnapshot() const;
+
+	/**
+	* C++ only: Serial of the current snapshot (see FGeoTransformerSnapshot::GetSerial), changed by each ApplySettings() and RebaseOrigin().
+	* A single atomic load, for objects keeping converted coordinates which must know when to convert them again. 0 before the first settings are applied.
+	*/
+	uint32 GetSettingsSerial() const;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Performance
+
+	/**
+	* If true, conversions for which an in-house closed-form implementation exists (Geographic <-> ECEF on a plain ellipsoidal CRS,
+	* Projected <-> Geographic for Transverse Mercator / UTM projected CRS) bypass PROJ. Each implementation is checked against PROJ when the settings are applied, and only used if both agree.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance")
+	bool bUseNativeConversions = true;
+
+	/**
+	* If true, PROJ is initialized and the settings applied on a background task when the actor is loaded or created, instead of blocking the level load.
+	* The settings are copied when the task starts, edits made meanwhile need an ApplySettings(). Functions called before IsReady() wait for its completion.
+	* Commandlets always initialize synchronously.
+	**/
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "GeoReferencing|Performance")
+	bool bInitializeAsynchronously = true;
+
+	/**
+	* If true, cooking saves the pipelines, ellipsoids and origin frame resolved from the CRS definitions with the actor. Cooked builds then start
+	* without querying the PROJ database : proj.db can be left out of the build, unless TransformCoordinates(), the accuracy queries or IsCRSStringValid() are used.
+	* Grid based transformations still need their grid files.
+	**/
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "GeoReferencing|Performance")
+	bool bCookResolvedState = true;
+
+	/**
+	* Maximum difference with PROJ (in meters) accepted when validating the native conversions
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance", meta = (ClampMin = "0.0", EditCondition = "bUseNativeConversions"))
+	double NativeConversionToleranceMeters = 0.0001;
+
+	/**
+	* Number of PROJ pipelines kept for the CRS pairs used by GetTransformationAccuracy and TransformCoordinates.
+	* Building a pipeline queries the PROJ database, the least recently used ones are destroyed first, also when the capacity is reduced.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance", meta = (ClampMin = "1"))
+	int32 TransformationRegistryCapacity = 16;
+
+	/**
+	* If true, GeographicToEngine and EngineToGeographic results are memoized, keyed on the exact input coordinates.
+	* Useful when the same locations are converted over and over (points of interest, spawners, HUD readouts). Hits and misses are reported in GetPerformanceStats(). Taken into account by ApplySettings(), which also empties the cache.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance")
+	bool bUseCoordinateCache = false;
+
+	/**
+	* Number of results kept by the coordinate cache. Newer results replace older ones sharing the same slot.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance", meta = (ClampMin = "16", EditCondition = "bUseCoordinateCache"))
+	int32 CoordinateCacheSize = 4096;
+
+	/**
+	* If true, the projection factors (and the FlatPlanet ENU vectors and tangent transforms derived from them) are computed once per cell of
+	* ProjectionFactorsCacheCellSize degrees, and reused for all the locations of the cell. Suited to pawns and widgets querying them every tick.
+	* Off by default, since the results are then those of the cell center instead of the exact location.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance")
+	bool bUseProjectionFactorsCache = false;
+
+	/**
+	* Size of the projection factors cache cells, in degrees. The default (about 1m) keeps the convergence error below 0.00001 degree.
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance", meta = (ClampMin = "0.0000001", EditCondition = "bUseProjectionFactorsCache"))
+	double ProjectionFactorsCacheCellSize = 0.00001;
+
+	/**
+	* If true, large batches are converted by interpolating the exact conversion sampled on an adaptive grid over the data bounding box,
+	* refined until the interpolation error at the test points stays within ApproximateBatchesMaxErrorMeters. Suited to dense data in a limited area
+	* (terrain grids, imagery, meshes). The achieved error and speedup are reported in GetPerformanceStats().
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance")
+	bool bUseApproximateBatches = false;
+
+	/**
+	* Maximum error of the approximate batches, in meters
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance", meta = (ClampMin = "0.000001", EditCondition = "bUseApproximateBatches"))
+	double ApproximateBatchesMaxErrorMeters = 0.001;
+
+	/**
+	* Batches smaller than this are always converted exactly, the approximation would not pay for its sampling
+	**/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "GeoReferencing|Performance", meta = (ClampMin = "1", EditCondition = "bUseApproximateBatches"))
+	int32 ApproximateBatchesMinPoints = 10000;
+
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
 #endif
 
 private:
 	void Initialize();
+	void OnInitialized(bool bSuccess);
+
+	// Copy of the properties read by ApplySettings, taken on the game thread : the asynchronous initialization must not read properties being edited
+	struct FAppliedSettings;
+	FAppliedSettings CaptureSettings() const;
+
+	// ApplySettings, without the editor notification which must be shown from the game thread. Returns false if a CRS definition could not be used.
+	bool ApplySettingsInternal(const FAppliedSettings& Settings);
+
+	// Resolve the CRS definitions against the PROJ database (pipelines, ellipsoids, native conversions)
+	bool ApplyProjectionSettings(const FAppliedSettings& Settings);
+
+	// Same from CookedState, if it was cooked for these settings. False if it can't be used.
+	bool ApplyCookedState(const FAppliedSettings& Settings);
+	static uint32 GetCookedSettingsHash(const FAppliedSettings& Settings);
+
+	// Origin transforms from the origin settings, or from CookedState
+	void ApplyOriginSettings(const FAppliedSettings& Settings, bool bFromCookedState);
+
+	// Origin only update, used by RebaseOrigin : the CRS pipelines, worker contexts and local frames are kept. False if the pipelines are not valid.
+	bool ApplyOriginInternal();
+
+#if WITH_EDITOR
+	bool BuildCookedState(FGeoReferencingCookedState& OutState) const;
+#endif
+
+	// Resolved state saved by the cook, see bCookResolvedState
+	UPROPERTY()
+	FGeoReferencingCookedState CookedState;
+#if WITH_EDITOR
+	void NotifyCRSError();
+#endif
+
+	// Batch helpers : copy a contiguous range to the output array, and convert it there in place
+	void GeographicToEngineRange(const FProjPipelines& Pipelines, const FGeographicCoordinates* Geographic, FVector* Engine, int32 Num);
+	void EngineToGeographicRange(const FProjPipelines& Pipelines, const FVector* Engine, FGeographicCoordinates* Geographic, int32 Num);
+
+	// In place conversion of strided coordinates, chunk by chunk, through the kernel instantiated by ApplySettings for the current settings.
+	// Each stage is a single proj_trans_generic call or a kernel pass
+	void TransformStreams(EGeoConversion Conversion, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams);
+
+	// Batch entry points conversion : approximate if enabled and worth it, exact otherwise
+	bool ShouldApproximateBatch(int32 NumCoordinates) const;
+	void TransformStreamsBatch(EGeoConversion Conversion, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams);
+	void TransformStreamsApproximate(EGeoConversion Conversion, const FProjPipelines& Pipelines, const FGeoCoordinateStreams& Streams);
+
+	// Batch tangent frames. Locations are read only, in the source space of LocationToECEF (EGeoConversion::Count for ECEF locations).
+	// The matrices are handed to OutputChunk chunk by chunk, from several threads.
+	void ComputeTangentMatrices(EGeoConversion LocationToECEF, const FGeoCoordinateStreams& Locations, TFunctionRef<void(int32 StartIndex, TConstArrayView<FMatrix> Matrices)> OutputChunk);
+
+	// proj_factors at a location, with no cache
+	bool ComputeProjectionFactors(const FGeographicCoordinates& GeographicCoordinates, FGeoProjectionFactors& Factors) const;
+
+	// FlatPlanet ENU vectors from the projection factors. False if they are not available at this location, finite differences are used instead.
+	bool GetFlatPlanetENUVectors(const FGeographicCoordinates& GeographicCoordinates, FVector& East, FVector& North, FVector& Up);
+
+	// Lock free, records into the latency histogram of Conversion. EGeoConversion::Count stands for TransformCoordinates.
+	void RecordBatchStats(EGeoConversion Conversion, int32 NumTransformations, double ElapsedMicroseconds);
 
-	// Performance statistics
+	// Performance statistics of the approximate batches. Latencies are recorded in histograms, see FGeoReferencingSystemInternals.
 	mutable FGeoReferencingStats PerformanceStats;
 	mutable FCriticalSection StatsMutex; // Thread safety for stats updates
 
@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGeoStreamingTransformStats;
+
+/**
+ * Settings of a streaming conversion (C++ only), see AGeoReferencingSystem::TransformArchive()
+ */
+struct FGeoStreamingTransformSettings
+{
+	/** Number of points read, converted and written at once. Two chunks are in memory at any time (24 bytes per point). */
+	int32 ChunkSize = 1024 * 1024;
+
+	/** Number of worker threads converting each chunk, each one with its own PROJ context */
+	int32 NumWorkers = 4;
+
+	/** Called after each chunk is written. Returning false stops the conversion, which then fails. */
+	TFunction<bool(const FGeoStreamingTransformStats&)> OnProgress;
+};
+
+/**
+ * Progress and throughput of a streaming conversion. Reading, converting and writing overlap, so their times add up to more than TotalSeconds.
+ */
+struct FGeoStreamingTransformStats
+{
+	int64 NumPoints = 0;		// Number of points in the input
+	int64 NumConverted = 0;		// Number of points converted and written so far
+
+	double ReadSeconds = 0.0;
+	double ConvertSeconds = 0.0;
+	double WriteSeconds = 0.0;
+	double StallSeconds = 0.0;	// Time spent by the I/O thread waiting for a conversion to complete
+	double TotalSeconds = 0.0;
+
+	double GetPointsPerSecond() const { return TotalSeconds > 0.0 ? static_cast<double>(NumConverted) / TotalSeconds : 0.0; }
+
+	/** Input and output bytes per second */
+	double GetMegabytesPerSecond() const { return GetPointsPerSecond() * 2.0 * 3.0 * sizeof(double) / (1024.0 * 1024.0); }
+
+	float GetProgress() const { return NumPoints > 0 ? static_cast<float>(static_cast<double>(NumConverted) / static_cast<double>(NumPoints)) : 1.0f; }
+};
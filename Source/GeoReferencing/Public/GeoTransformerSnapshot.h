@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/PimplPtr.h"
+#include "GeoReferencingSystem.h"
+
+/**
+ * Immutable state of the conversions of an AGeoReferencingSystem (C++ only) : transforms, ellipsoid, kernels and PROJ pipelines definitions.
+ *
+ * ApplySettings() never modifies a snapshot : it builds a new one and publishes it atomically, so a snapshot stays valid and consistent
+ * for as long as a reference to it is held, including after the actor is destroyed. Any thread (async loading, physics, audio...) can hold one
+ * and convert with it without touching the actor. PROJ objects can't be shared between threads : each conversion leases a private PROJ context
+ * with its own pipelines from a pool owned by the snapshot, created on first use by the thread needing it. The snapshots published by
+ * RebaseOrigin() only change the origin, they share the pool of the previous one.
+ */
+class GEOREFERENCING_API FGeoTransformerSnapshot : public TSharedFromThis<FGeoTransformerSnapshot, ESPMode::ThreadSafe>
+{
+public:
+	~FGeoTransformerSnapshot();
+
+	/** Changed by each ApplySettings() and RebaseOrigin() of the actor, never reused, to tell whether cached results come from the current settings */
+	uint32 GetSerial() const { return Serial; }
+
+	EPlanetShape GetPlanetShape() const { return PlanetShape; }
+	const FString& GetProjectedCRS() const { return ProjectedCRS; }
+	const FString& GetGeographicCRS() const { return GeographicCRS; }
+
+	/**
+	 * In place conversion, from any thread. Geographic coordinates are stored as X = Longitude, Y = Latitude, Z = Altitude.
+	 * Same results as the batch functions of the actor with the settings of this snapshot (approximate batches aside).
+	 * Returns false if the pipelines of the snapshot are not valid, or no PROJ context could be created for this thread.
+	 */
+	bool Transform(EGeoConversion Conversion, const FGeoCoordinateStreams& Streams) const;
+	bool Transform(EGeoConversion Conversion, TArrayView<FVector> Coordinates) const;
+	bool Transform(EGeoConversion Conversion, FVector& Coordinates) const;
+
+	/** Destroy the idle PROJ contexts, which are recreated on demand. Done by the actor when this snapshot is replaced by one with other pipelines, the rest of its state is destroyed with the last reference. */
+	void TrimIdleContexts() const;
+
+private:
+	friend class AGeoReferencingSystem;
+	FGeoTransformerSnapshot();
+
+	class FState;
+	TPimplPtr<FState> State;
+
+	uint32 Serial = 0;
+	EPlanetShape PlanetShape = EPlanetShape::RoundPlanet;
+	FString ProjectedCRS;
+	FString GeographicCRS;
+};
+
+typedef TSharedPtr<const FGeoTransformerSnapshot, ESPMode::ThreadSafe> FGeoTransformerSnapshotPtr;
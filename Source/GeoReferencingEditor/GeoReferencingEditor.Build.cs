@@ -20,6 +20,7 @@ public class GeoReferencingEditor : ModuleRules
 				"Engine",
 				"GeoReferencing",
 				"InputCore",
+				"Json",
 				"Projects",
 				"Slate",
 				"SlateCore",
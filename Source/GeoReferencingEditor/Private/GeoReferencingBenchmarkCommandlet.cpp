@@ -0,0 +1,381 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingBenchmarkCommandlet.h"
+
+#include "GeoJSONReader.h"
+#include "GeoJSONWriter.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGeoReferencingBenchmark, Log, All);
+
+namespace GeoReferencingBenchmark
+{
+	enum class ESpace : uint8 { Engine, Projected, Geographic, ECEF };
+
+	ESpace GetSourceSpace(EGeoConversion Conversion)
+	{
+		switch (Conversion)
+		{
+		case EGeoConversion::EngineToProjected:
+		case EGeoConversion::EngineToGeographic:
+		case EGeoConversion::EngineToECEF:
+			return ESpace::Engine;
+		case EGeoConversion::ProjectedToEngine:
+		case EGeoConversion::ProjectedToGeographic:
+		case EGeoConversion::ProjectedToECEF:
+			return ESpace::Projected;
+		case EGeoConversion::ECEFToEngine:
+		case EGeoConversion::ECEFToProjected:
+		case EGeoConversion::ECEFToGeographic:
+			return ESpace::ECEF;
+		default:
+			return ESpace::Geographic;
+		}
+	}
+
+	// Conversion bringing the synthetic geographic points to a source space
+	EGeoConversion GetConversionFromGeographic(ESpace Space)
+	{
+		switch (Space)
+		{
+		case ESpace::Engine: return EGeoConversion::GeographicToEngine;
+		case ESpace::Projected: return EGeoConversion::GeographicToProjected;
+		case ESpace::ECEF: return EGeoConversion::GeographicToECEF;
+		default: return EGeoConversion::Count;
+		}
+	}
+
+	// One point through the single point API
+	void ConvertPoint(AGeoReferencingSystem& System, EGeoConversion Conversion, FVector& Point)
+	{
+		FGeographicCoordinates Geographic(Point.X, Point.Y, Point.Z);
+		FVector Result;
+		switch (Conversion)
+		{
+		case EGeoConversion::EngineToProjected: System.EngineToProjected(Point, Result); break;
+		case EGeoConversion::ProjectedToEngine: System.ProjectedToEngine(Point, Result); break;
+		case EGeoConversion::EngineToGeographic: System.EngineToGeographic(Point, Geographic); break;
+		case EGeoConversion::GeographicToEngine: System.GeographicToEngine(Geographic, Result); break;
+		case EGeoConversion::EngineToECEF: System.EngineToECEF(Point, Result); break;
+		case EGeoConversion::ECEFToEngine: System.ECEFToEngine(Point, Result); break;
+		case EGeoConversion::ProjectedToGeographic: System.ProjectedToGeographic(Point, Geographic); break;
+		case EGeoConversion::GeographicToProjected: System.GeographicToProjected(Geographic, Result); break;
+		case EGeoConversion::ProjectedToECEF: System.ProjectedToECEF(Point, Result); break;
+		case EGeoConversion::ECEFToProjected: System.ECEFToProjected(Point, Result); break;
+		case EGeoConversion::GeographicToECEF: System.GeographicToECEF(Geographic, Result); break;
+		case EGeoConversion::ECEFToGeographic: System.ECEFToGeographic(Point, Geographic); break;
+		default: break;
+		}
+	}
+}
+
+UGeoReferencingBenchmarkCommandlet::UGeoReferencingBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGeoReferencingBenchmarkCommandlet::Main(const FString& Params)
+{
+	MaxThreads = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	if (FParse::Param(*Params, TEXT("Quick")))
+	{
+		MaxPoints = 100000;
+		MaxGeoJSONPoints = 10000;
+		Repeat = 1;
+	}
+	FParse::Value(*Params, TEXT("MaxPoints="), MaxPoints);
+	FParse::Value(*Params, TEXT("MaxThreads="), MaxThreads);
+	FParse::Value(*Params, TEXT("MaxGeoJSONPoints="), MaxGeoJSONPoints);
+	FParse::Value(*Params, TEXT("Repeat="), Repeat);
+	MaxPoints = FMath::Max(1, MaxPoints);
+	MaxThreads = FMath::Max(1, MaxThreads);
+	Repeat = FMath::Max(1, Repeat);
+
+	FString Output = FPaths::ProjectSavedDir() / TEXT("GeoReferencingBenchmark") / FDateTime::Now().ToString();
+	FParse::Value(*Params, TEXT("Output="), Output);
+
+	// The system is configured from the command line defaults : UTM 31N / WGS84, the plugin defaults
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	AGeoReferencingSystem* System = World->SpawnActor<AGeoReferencingSystem>();
+	if (System == nullptr)
+	{
+		UE_LOG(LogGeoReferencingBenchmark, Error, TEXT("Can't create a GeoReferencingSystem actor"));
+		World->DestroyWorld(false);
+		return 1;
+	}
+	FParse::Value(*Params, TEXT("ProjectedCRS="), System->ProjectedCRS);
+	FParse::Value(*Params, TEXT("GeographicCRS="), System->GeographicCRS);
+
+	struct FConfiguration
+	{
+		const TCHAR* Name;
+		EPlanetShape PlanetShape;
+		bool bOriginAtPlanetCenter;
+	};
+	const FConfiguration Configurations[] =
+	{
+		{ TEXT("FlatPlanet"), EPlanetShape::FlatPlanet, false },
+		{ TEXT("RoundPlanet"), EPlanetShape::RoundPlanet, false },
+		{ TEXT("RoundPlanet_OriginAtPlanetCenter"), EPlanetShape::RoundPlanet, true },
+	};
+	for (const FConfiguration& Configuration : Configurations)
+	{
+		System->PlanetShape = Configuration.PlanetShape;
+		System->bOriginAtPlanetCenter = Configuration.bOriginAtPlanetCenter;
+		System->ApplySettings();
+		RunConversions(*System, Configuration.Name);
+	}
+	World->DestroyWorld(false);
+
+	RunGeoJSON();
+
+	const bool bSuccess = WriteJSON(Output + TEXT(".json")) && WriteCSV(Output + TEXT(".csv"));
+	if (bSuccess)
+	{
+		UE_LOG(LogGeoReferencingBenchmark, Display, TEXT("%d results written to %s.json and %s.csv"), Results.Num(), *Output, *Output);
+	}
+	return bSuccess ? 0 : 1;
+}
+
+void UGeoReferencingBenchmarkCommandlet::RunConversions(AGeoReferencingSystem& System, const FString& Configuration)
+{
+	using namespace GeoReferencingBenchmark;
+
+	// Synthetic points spread over about 100 km around the origin, as terrain or survey data would be
+	FGeographicCoordinates Origin;
+	System.ProjectedToGeographic(FVector(System.OriginProjectedCoordinatesEasting, System.OriginProjectedCoordinatesNorthing, System.OriginProjectedCoordinatesUp), Origin);
+
+	FRandomStream Random(1234);
+	FGeoCoordinateBuffer Geographic;
+	Geographic.SetNum(MaxPoints);
+	for (int32 i = 0; i < MaxPoints; ++i)
+	{
+		Geographic.X[i] = Origin.Longitude + Random.FRandRange(-0.5f, 0.5f);
+		Geographic.Y[i] = Origin.Latitude + Random.FRandRange(-0.5f, 0.5f);
+		Geographic.Z[i] = Random.FRandRange(0.0f, 1000.0f);
+	}
+
+	FGeoCoordinateBuffer Source;
+	FGeoCoordinateBuffer Work;
+	for (EGeoConversion Conversion : TEnumRange<EGeoConversion>())
+	{
+		const FString Operation = StaticEnum<EGeoConversion>()->GetNameStringByValue(static_cast<int64>(Conversion));
+
+		Source = Geographic;
+		const EGeoConversion ToSource = GetConversionFromGeographic(GetSourceSpace(Conversion));
+		if (ToSource != EGeoConversion::Count)
+		{
+			System.TransformBatch(ToSource, Source);
+		}
+
+		for (int32 NumPoints = 1; NumPoints <= MaxPoints; NumPoints *= 10)
+		{
+			// Single point API, up to 100k points
+			if (NumPoints <= 100000)
+			{
+				const double Seconds = Measure([] {}, [&]
+				{
+					for (int32 i = 0; i < NumPoints; ++i)
+					{
+						FVector Point = Source.GetVector(i);
+						ConvertPoint(System, Conversion, Point);
+					}
+				});
+				AddResult(TEXT("Conversions"), Configuration, Operation, TEXT("Single"), NumPoints, 1, Seconds);
+			}
+
+			// Batch API
+			Work.SetNum(NumPoints);
+			auto CopySource = [&]
+			{
+				FMemory::Memcpy(Work.X.GetData(), Source.X.GetData(), NumPoints * sizeof(double));
+				FMemory::Memcpy(Work.Y.GetData(), Source.Y.GetData(), NumPoints * sizeof(double));
+				FMemory::Memcpy(Work.Z.GetData(), Source.Z.GetData(), NumPoints * sizeof(double));
+			};
+			{
+				const double Seconds = Measure(CopySource, [&] { System.TransformBatch(Conversion, Work); });
+				AddResult(TEXT("Conversions"), Configuration, Operation, TEXT("Batch"), NumPoints, 1, Seconds);
+			}
+
+			// Asynchronous API, the batch split over several tasks. Below 10k points per task, the task overhead dominates.
+			for (int32 NumThreads = 2; NumThreads <= MaxThreads && NumPoints / NumThreads >= 10000; NumThreads *= 2)
+			{
+				TArray<TSharedRef<FGeoCoordinateBuffer>> Slices;
+				const int32 SliceSize = FMath::DivideAndRoundUp(NumPoints, NumThreads);
+				for (int32 StartIndex = 0; StartIndex < NumPoints; StartIndex += SliceSize)
+				{
+					TSharedRef<FGeoCoordinateBuffer>& Slice = Slices.Add_GetRef(MakeShared<FGeoCoordinateBuffer>());
+					Slice->SetNum(FMath::Min(SliceSize, NumPoints - StartIndex));
+				}
+
+				auto CopySlices = [&]
+				{
+					int32 StartIndex = 0;
+					for (const TSharedRef<FGeoCoordinateBuffer>& Slice : Slices)
+					{
+						for (int32 i = 0; i < Slice->Num(); ++i)
+						{
+							Slice->Set(i, Source.GetVector(StartIndex + i));
+						}
+						StartIndex += Slice->Num();
+					}
+				};
+				const double Seconds = Measure(CopySlices, [&]
+				{
+					TArray<TFuture<bool>> Futures;
+					for (const TSharedRef<FGeoCoordinateBuffer>& Slice : Slices)
+					{
+						Futures.Add(System.TransformBatchAsync(Conversion, Slice));
+					}
+					for (TFuture<bool>& Future : Futures)
+					{
+						Future.Wait();
+					}
+				});
+				AddResult(TEXT("Conversions"), Configuration, Operation, TEXT("Async"), NumPoints, NumThreads, Seconds);
+			}
+
+			if (NumPoints > MAX_int32 / 10)
+			{
+				break;
+			}
+		}
+	}
+}
+
+void UGeoReferencingBenchmarkCommandlet::RunGeoJSON()
+{
+	const FString Filename = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("GeoReferencingBenchmark"), TEXT(".geojson"));
+
+	FRandomStream Random(1234);
+	for (int32 NumPoints = 1000; NumPoints <= MaxGeoJSONPoints; NumPoints *= 10)
+	{
+		TArray<FGeographicCoordinates> Points;
+		TArray<FString> Properties;
+		Points.Reserve(NumPoints);
+		Properties.Reserve(NumPoints);
+		for (int32 i = 0; i < NumPoints; ++i)
+		{
+			Points.Emplace(Random.FRandRange(-180.0f, 180.0f), Random.FRandRange(-90.0f, 90.0f), Random.FRandRange(0.0f, 1000.0f));
+			Properties.Add(FString::Printf(TEXT("{\"id\":%d,\"name\":\"Point %d\"}"), i, i));
+		}
+
+		FString GeoJSON;
+		AddResult(TEXT("GeoJSON"), TEXT(""), TEXT("ExportToGeoJSONString"), TEXT("String"), NumPoints, 1,
+			Measure([] {}, [&] { GeoJSON = UGeoJSONWriter::ExportToGeoJSONString(Points, Properties); }));
+
+		AddResult(TEXT("GeoJSON"), TEXT(""), TEXT("SaveGeoJSONFile"), TEXT("File"), NumPoints, 1,
+			Measure([] {}, [&] { UGeoJSONWriter::SaveGeoJSONFile(Filename, Points, Properties); }));
+
+		TArray<FGeographicCoordinates> LoadedPoints;
+		TArray<FString> LoadedProperties;
+		auto ResetLoaded = [&] { LoadedPoints.Reset(); LoadedProperties.Reset(); };
+
+		AddResult(TEXT("GeoJSON"), TEXT(""), TEXT("LoadGeoJSONString"), TEXT("String"), NumPoints, 1,
+			Measure(ResetLoaded, [&] { UGeoJSONReader::LoadGeoJSONString(GeoJSON, LoadedPoints, LoadedProperties); }));
+
+		AddResult(TEXT("GeoJSON"), TEXT(""), TEXT("LoadGeoJSONFile"), TEXT("File"), NumPoints, 1,
+			Measure(ResetLoaded, [&] { UGeoJSONReader::LoadGeoJSONFile(Filename, LoadedPoints, LoadedProperties); }));
+
+		if (LoadedPoints.Num() != NumPoints)
+		{
+			UE_LOG(LogGeoReferencingBenchmark, Warning, TEXT("GeoJSON round trip returned %d points instead of %d"), LoadedPoints.Num(), NumPoints);
+		}
+	}
+
+	IFileManager::Get().Delete(*Filename);
+}
+
+double UGeoReferencingBenchmarkCommandlet::Measure(TFunctionRef<void()> Setup, TFunctionRef<void()> Run) const
+{
+	double BestSeconds = TNumericLimits<double>::Max();
+	for (int32 Iteration = 0; Iteration < Repeat; ++Iteration)
+	{
+		Setup();
+		const double StartTime = FPlatformTime::Seconds();
+		Run();
+		BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+	}
+	return BestSeconds;
+}
+
+void UGeoReferencingBenchmarkCommandlet::AddResult(const FString& Suite, const FString& Configuration, const FString& Operation, const FString& Api, int32 NumPoints, int32 NumThreads, double Seconds)
+{
+	FResult& Result = Results.AddDefaulted_GetRef();
+	Result.Suite = Suite;
+	Result.Configuration = Configuration;
+	Result.Operation = Operation;
+	Result.Api = Api;
+	Result.NumPoints = NumPoints;
+	Result.NumThreads = NumThreads;
+	Result.Seconds = Seconds;
+	Result.PointsPerSecond = Seconds > 0.0 ? NumPoints / Seconds : 0.0;
+
+	UE_LOG(LogGeoReferencingBenchmark, Display, TEXT("%-10s %-34s %-24s %-7s %9d points %3d threads : %14.0f points/s"),
+		*Suite, *Configuration, *Operation, *Api, NumPoints, NumThreads, Result.PointsPerSecond);
+}
+
+bool UGeoReferencingBenchmarkCommandlet::WriteJSON(const FString& Filename) const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+
+	TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GeoReferencing"));
+	Root->SetStringField(TEXT("PluginVersion"), Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString());
+	Root->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+	Root->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Root->SetNumberField(TEXT("Cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Root->SetStringField(TEXT("Date"), FDateTime::UtcNow().ToIso8601());
+	Root->SetNumberField(TEXT("Repeat"), Repeat);
+
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	for (const FResult& Result : Results)
+	{
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetStringField(TEXT("Suite"), Result.Suite);
+		ResultObject->SetStringField(TEXT("Configuration"), Result.Configuration);
+		ResultObject->SetStringField(TEXT("Operation"), Result.Operation);
+		ResultObject->SetStringField(TEXT("Api"), Result.Api);
+		ResultObject->SetNumberField(TEXT("NumPoints"), Result.NumPoints);
+		ResultObject->SetNumberField(TEXT("NumThreads"), Result.NumThreads);
+		ResultObject->SetNumberField(TEXT("Seconds"), Result.Seconds);
+		ResultObject->SetNumberField(TEXT("PointsPerSecond"), Result.PointsPerSecond);
+		ResultValues.Add(MakeShared<FJsonValueObject>(ResultObject));
+	}
+	Root->SetArrayField(TEXT("Results"), ResultValues);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Root, Writer))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Json, *Filename);
+}
+
+bool UGeoReferencingBenchmarkCommandlet::WriteCSV(const FString& Filename) const
+{
+	FString Csv = TEXT("Suite,Configuration,Operation,Api,NumPoints,NumThreads,Seconds,PointsPerSecond\n");
+	for (const FResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%s,%s,%d,%d,%.9f,%.1f\n"),
+			*Result.Suite, *Result.Configuration, *Result.Operation, *Result.Api, Result.NumPoints, Result.NumThreads, Result.Seconds, Result.PointsPerSecond);
+	}
+	return FFileHelper::SaveStringToFile(Csv, *Filename);
+}
@@ -0,0 +1,152 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GeoReferencingTransformCommandlet.h"
+
+#include "GeoReferencingSystem.h"
+#include "GeoStreamingTransform.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGeoReferencingTransformCommandlet, Log, All);
+
+UGeoReferencingTransformCommandlet::UGeoReferencingTransformCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UGeoReferencingTransformCommandlet::Main(const FString& Params)
+{
+	FString InputFilename;
+	FString OutputFilename;
+	FString ConversionName;
+	if (!FParse::Value(*Params, TEXT("Input="), InputFilename) ||
+		!FParse::Value(*Params, TEXT("Output="), OutputFilename) ||
+		!FParse::Value(*Params, TEXT("Conversion="), ConversionName))
+	{
+		UE_LOG(LogGeoReferencingTransformCommandlet, Error, TEXT("Usage: -run=GeoReferencingTransform -Input=<File> -Output=<File> -Conversion=<EGeoConversion> [-Map=<Map> | CRS and Origin parameters] [-ChunkSize=<Points>] [-Workers=<Threads>]"));
+		return 1;
+	}
+
+	const int64 ConversionValue = StaticEnum<EGeoConversion>()->GetValueByNameString(ConversionName);
+	if (ConversionValue == INDEX_NONE || ConversionValue >= static_cast<int64>(EGeoConversion::Count))
+	{
+		UE_LOG(LogGeoReferencingTransformCommandlet, Error, TEXT("Unknown conversion %s"), *ConversionName);
+		return 1;
+	}
+	const EGeoConversion Conversion = static_cast<EGeoConversion>(ConversionValue);
+
+	// Georeferencing from a map, or from the command line in a transient world
+	UWorld* TransientWorld = nullptr;
+	AGeoReferencingSystem* GeoReferencingSystem = nullptr;
+	FString MapName;
+	if (FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		GeoReferencingSystem = FindMapGeoReferencingSystem(MapName);
+	}
+	else
+	{
+		TransientWorld = UWorld::CreateWorld(EWorldType::Inactive, false);
+		GeoReferencingSystem = SpawnGeoReferencingSystem(TransientWorld, Params);
+	}
+	if (GeoReferencingSystem == nullptr)
+	{
+		return 1;
+	}
+
+	FGeoStreamingTransformSettings Settings;
+	FParse::Value(*Params, TEXT("ChunkSize="), Settings.ChunkSize);
+	FParse::Value(*Params, TEXT("Workers="), Settings.NumWorkers);
+
+	double LastReportTime = 0.0;
+	Settings.OnProgress = [&LastReportTime](const FGeoStreamingTransformStats& Stats)
+	{
+		if (Stats.TotalSeconds - LastReportTime >= 1.0)
+		{
+			LastReportTime = Stats.TotalSeconds;
+			UE_LOG(LogGeoReferencingTransformCommandlet, Display, TEXT("%5.1f%% - %lld / %lld points - %.0f points/s"),
+				Stats.GetProgress() * 100.0f, Stats.NumConverted, Stats.NumPoints, Stats.GetPointsPerSecond());
+		}
+		return true;
+	};
+
+	FGeoStreamingTransformStats Stats;
+	const bool bSuccess = GeoReferencingSystem->TransformFile(Conversion, InputFilename, OutputFilename, Settings, Stats);
+
+	UE_LOG(LogGeoReferencingTransformCommandlet, Display, TEXT("%s: %lld points in %.2f s, %.0f points/s, %.1f MB/s (read %.2f s, convert %.2f s, write %.2f s, stalled %.2f s)"),
+		bSuccess ? TEXT("Done") : TEXT("Failed"), Stats.NumConverted, Stats.TotalSeconds, Stats.GetPointsPerSecond(), Stats.GetMegabytesPerSecond(),
+		Stats.ReadSeconds, Stats.ConvertSeconds, Stats.WriteSeconds, Stats.StallSeconds);
+
+	if (TransientWorld != nullptr)
+	{
+		TransientWorld->DestroyWorld(false);
+	}
+	return bSuccess ? 0 : 1;
+}
+
+AGeoReferencingSystem* UGeoReferencingTransformCommandlet::FindMapGeoReferencingSystem(const FString& MapName) const
+{
+	UWorld* World = LoadObject<UWorld>(nullptr, *MapName);
+	if (World == nullptr || World->PersistentLevel == nullptr)
+	{
+		UE_LOG(LogGeoReferencingTransformCommandlet, Error, TEXT("Can't load map %s"), *MapName);
+		return nullptr;
+	}
+
+	// The world is not initialized, so its actors are looked up in the persistent level directly
+	AGeoReferencingSystem* GeoReferencingSystem = nullptr;
+	for (AActor* Actor : World->PersistentLevel->Actors)
+	{
+		if (AGeoReferencingSystem* Candidate = Cast<AGeoReferencingSystem>(Actor))
+		{
+			if (GeoReferencingSystem != nullptr)
+			{
+				UE_LOG(LogGeoReferencingTransformCommandlet, Error, TEXT("Multiple GeoReferencingSystem actors found in %s"), *MapName);
+				return nullptr;
+			}
+			GeoReferencingSystem = Candidate;
+		}
+	}
+
+	if (GeoReferencingSystem == nullptr)
+	{
+		UE_LOG(LogGeoReferencingTransformCommandlet, Error, TEXT("GeoReferencingSystem actor not found in %s"), *MapName);
+	}
+	return GeoReferencingSystem;
+}
+
+AGeoReferencingSystem* UGeoReferencingTransformCommandlet::SpawnGeoReferencingSystem(UWorld* World, const FString& Params) const
+{
+	AGeoReferencingSystem* GeoReferencingSystem = World->SpawnActor<AGeoReferencingSystem>();
+	if (GeoReferencingSystem == nullptr)
+	{
+		UE_LOG(LogGeoReferencingTransformCommandlet, Error, TEXT("Can't create a GeoReferencingSystem actor"));
+		return nullptr;
+	}
+
+	FParse::Value(*Params, TEXT("ProjectedCRS="), GeoReferencingSystem->ProjectedCRS);
+	FParse::Value(*Params, TEXT("GeographicCRS="), GeoReferencingSystem->GeographicCRS);
+
+	FString PlanetShape;
+	if (FParse::Value(*Params, TEXT("PlanetShape="), PlanetShape))
+	{
+		GeoReferencingSystem->PlanetShape = PlanetShape.Equals(TEXT("Round"), ESearchCase::IgnoreCase) ? EPlanetShape::RoundPlanet : EPlanetShape::FlatPlanet;
+	}
+
+	GeoReferencingSystem->bOriginAtPlanetCenter = FParse::Param(*Params, TEXT("OriginAtPlanetCenter"));
+	if (FParse::Value(*Params, TEXT("OriginLatitude="), GeoReferencingSystem->OriginLatitude) |
+		FParse::Value(*Params, TEXT("OriginLongitude="), GeoReferencingSystem->OriginLongitude) |
+		FParse::Value(*Params, TEXT("OriginAltitude="), GeoReferencingSystem->OriginAltitude))
+	{
+		GeoReferencingSystem->bOriginLocationInProjectedCRS = false;
+	}
+	FParse::Value(*Params, TEXT("OriginEasting="), GeoReferencingSystem->OriginProjectedCoordinatesEasting);
+	FParse::Value(*Params, TEXT("OriginNorthing="), GeoReferencingSystem->OriginProjectedCoordinatesNorthing);
+	FParse::Value(*Params, TEXT("OriginUp="), GeoReferencingSystem->OriginProjectedCoordinatesUp);
+
+	GeoReferencingSystem->ApplySettings();
+	return GeoReferencingSystem;
+}
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "GeoReferencingSystem.h"
+
+#include "GeoReferencingBenchmarkCommandlet.generated.h"
+
+/**
+ * Measure the throughput of every conversion of AGeoReferencingSystem, and of the GeoJSON reader and writer, on synthetic data.
+ * Results are written as JSON and CSV, to compare plugin versions.
+ *
+ * UnrealEditor-Cmd.exe <Project> -run=GeoReferencingBenchmark [-Output=<Path without extension>] [-MaxPoints=<N>] [-MaxThreads=<N>]
+ *     [-Repeat=<N>] [-MaxGeoJSONPoints=<N>] [-Quick]
+ *
+ * Each conversion is run for both planet shapes (and the origin at planet center for round planets), for batch sizes from 1 to MaxPoints
+ * by powers of 10, through the single point API, the batch API and the asynchronous API with 1 to MaxThreads tasks. The best of Repeat runs is kept.
+ */
+UCLASS()
+class UGeoReferencingBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGeoReferencingBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	struct FResult
+	{
+		FString Suite;
+		FString Configuration;
+		FString Operation;
+		FString Api;
+		int32 NumPoints = 0;
+		int32 NumThreads = 1;
+		double Seconds = 0.0;
+		double PointsPerSecond = 0.0;
+	};
+
+	void RunConversions(AGeoReferencingSystem& System, const FString& Configuration);
+	void RunGeoJSON();
+
+	/** Best time of Repeat runs of Run(), after Setup() before each run */
+	double Measure(TFunctionRef<void()> Setup, TFunctionRef<void()> Run) const;
+	void AddResult(const FString& Suite, const FString& Configuration, const FString& Operation, const FString& Api, int32 NumPoints, int32 NumThreads, double Seconds);
+
+	bool WriteJSON(const FString& Filename) const;
+	bool WriteCSV(const FString& Filename) const;
+
+	TArray<FResult> Results;
+	int32 MaxPoints = 10000000;
+	int32 MaxThreads = 1;
+	int32 MaxGeoJSONPoints = 100000;
+	int32 Repeat = 3;
+};
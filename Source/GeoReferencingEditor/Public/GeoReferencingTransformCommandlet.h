@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "GeoReferencingTransformCommandlet.generated.h"
+
+class AGeoReferencingSystem;
+
+/**
+ * Convert a raw point file (X, Y, Z doubles, 24 bytes per point) with the streaming pipeline of AGeoReferencingSystem.
+ *
+ * UnrealEditor-Cmd.exe <Project> -run=GeoReferencingTransform -Input=<File> -Output=<File> -Conversion=<EGeoConversion>
+ *     [-Map=<Map package> | -ProjectedCRS=<CRS> -GeographicCRS=<CRS> -PlanetShape=Flat|Round
+ *      -OriginLatitude=<deg> -OriginLongitude=<deg> -OriginAltitude=<m> | -OriginEasting=<m> -OriginNorthing=<m> -OriginUp=<m> | -OriginAtPlanetCenter]
+ *     [-ChunkSize=<Points>] [-Workers=<Threads>]
+ *
+ * With -Map, the GeoReferencingSystem actor of the map is used. Otherwise one is created from the other parameters.
+ */
+UCLASS()
+class UGeoReferencingTransformCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGeoReferencingTransformCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	AGeoReferencingSystem* FindMapGeoReferencingSystem(const FString& MapName) const;
+	AGeoReferencingSystem* SpawnGeoReferencingSystem(UWorld* World, const FString& Params) const;
+};